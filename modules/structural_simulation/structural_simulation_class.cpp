@@ -8,10 +8,17 @@
 
 #include "structural_simulation_class.h"
 
+#include <mutex>
+#include <tbb/task_group.h>
+
 ////////////////////////////////////////////////////
 /* global functions in StructuralSimulation  */
 ////////////////////////////////////////////////////
 
+// the relaxation parameters, which are also the key of the relaxation cache
+const int relaxation_steps = 1000;
+const Real random_displacement_ratio = 0.25;
+
 BodyPartFromMesh::BodyPartFromMesh(SPHBody &body, SharedPtr<TriangleMeshShape> triangle_mesh_shape_ptr)
     : BodyRegionByParticle(body, triangle_mesh_shape_ptr)
 {
@@ -76,7 +83,7 @@ void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
     //----------------------------------------------------------------------
     //	Particle relaxation starts here.
     //----------------------------------------------------------------------
-    random_solid_body_from_mesh_particles.exec(0.25);
+    random_solid_body_from_mesh_particles.exec(random_displacement_ratio);
     relaxation_step_inner.SurfaceBounding().exec();
     if (write_particle_relaxation_data)
     {
@@ -87,7 +94,7 @@ void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
     //	Particle relaxation time stepping start here.
     //----------------------------------------------------------------------
     int ite_p = 0;
-    while (ite_p < 1000)
+    while (ite_p < relaxation_steps)
     {
         relaxation_step_inner.exec();
         ite_p += 1;
@@ -103,7 +110,16 @@ void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
     std::cout << "The physics relaxation process of the imported model finished !" << std::endl;
 }
 
-std::tuple<Vecd *, Real *> generateAndRelaxParticlesFromMesh(
+std::tuple<StdLargeVec<Vecd>, StdLargeVec<Real>> copyParticlePositionsAndVolumes(BaseParticles &particles)
+{
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Real *Vol = particles.VolumetricMeasures();
+    return std::make_tuple(StdLargeVec<Vecd>(pos, pos + total_real_particles),
+                           StdLargeVec<Real>(Vol, Vol + total_real_particles));
+}
+
+std::tuple<StdLargeVec<Vecd>, StdLargeVec<Real>> generateAndRelaxParticlesFromMesh(
     SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution, bool particle_relaxation, bool write_particle_relaxation_data)
 {
     BoundingBox bb = triangle_mesh_shape->getBounds();
@@ -111,16 +127,36 @@ std::tuple<Vecd *, Real *> generateAndRelaxParticlesFromMesh(
     SolidBody model(system, triangle_mesh_shape);
     model.defineBodyLevelSetShape()->cleanLevelSet();
     model.defineMaterial<Solid>();
-    model.generateParticles<BaseParticles, Lattice>();
 
-    if (particle_relaxation)
+    if (!particle_relaxation)
+    {
+        model.generateParticles<BaseParticles, Lattice>();
+        return copyParticlePositionsAndVolumes(model.getBaseParticles());
+    }
+
     {
-        system.setIOEnvironment();
+        // the bodies are relaxed concurrently, so the shared folders are only set up one at a time
+        // and the output of the other bodies is kept
+        static std::mutex io_environment_mutex;
+        std::lock_guard<std::mutex> lock(io_environment_mutex);
+        system.setIOEnvironment(false);
+    }
+    // the relaxation is skipped if the relaxed particles of the same mesh and resolution are cached
+    ParticleRelaxationCache relaxation_cache(model, {Real(relaxation_steps), random_displacement_ratio});
+    if (relaxation_cache.isCached())
+    {
+        model.generateParticles<BaseParticles, Reload>(relaxation_cache.ReloadName());
+    }
+    else
+    {
+        model.generateParticles<BaseParticles, Lattice>();
         InnerRelation inner_relation(model);
         relaxParticlesSingleResolution(write_particle_relaxation_data, model, inner_relation);
+        relaxation_cache.writeToFile();
     }
 
-    return std::tuple<Vecd *, Real *>(model.getBaseParticles().ParticlePositions(), model.getBaseParticles().VolumetricMeasures());
+    // the particle data are copied as the standalone system is destroyed on return
+    return copyParticlePositionsAndVolumes(model.getBaseParticles());
 }
 
 BodyPartByParticle *createBodyPartFromMesh(SPHBody &body, const StlList &stl_list, size_t body_index, SharedPtr<TriangleMeshShape> tmesh)
@@ -229,7 +265,7 @@ StructuralSimulation::StructuralSimulation(const StructuralSimulationInput &inpu
     system_.setRunParticleRelaxation(true);
     // initialize solid bodies with their properties
     initializeElasticSolidBodies();
-    // contacts
+    // contacts, only after all bodies are ready
     initializeAllContacts();
     // boundary conditions
     initializeGravity();
@@ -315,7 +351,23 @@ void StructuralSimulation::initializeElasticSolidBodies()
 {
     solid_body_list_ = {};
     particle_normal_update_ = {};
-    for (size_t i = 0; i < body_mesh_list_.size(); i++)
+    size_t number_of_bodies = body_mesh_list_.size();
+    // The particles of each body are generated and relaxed in a standalone system,
+    // which only depends on the body mesh and runs as a separate task.
+    StdVec<std::tuple<StdLargeVec<Vecd>, StdLargeVec<Real>>> particles(number_of_bodies);
+    tbb::task_group relaxation_tasks;
+    for (size_t i = 0; i < number_of_bodies; i++)
+    {
+        relaxation_tasks.run(
+            [&, i]()
+            {
+                particles[i] = generateAndRelaxParticlesFromMesh(
+                    body_mesh_list_[i], resolution_list_[i], particle_relaxation_list_[i], write_particle_relaxation_data_);
+            });
+    }
+    relaxation_tasks.wait();
+    // The bodies are added in the input order so that the system body list is deterministic.
+    for (size_t i = 0; i < number_of_bodies; i++)
     {
         std::string temp_name = "";
 #ifdef __EMSCRIPTEN__
@@ -325,13 +377,10 @@ void StructuralSimulation::initializeElasticSolidBodies()
 #endif // __EMSCRIPTEN__
        // we delete the .stl ending
         temp_name.erase(temp_name.size() - 4);
-        // create the initial particles from the triangle mesh shape with particle relaxation option
-        std::tuple<Vecd *, Real *> particles =
-            generateAndRelaxParticlesFromMesh(body_mesh_list_[i], resolution_list_[i], particle_relaxation_list_[i], write_particle_relaxation_data_);
 
         // get the particles' initial position and their volume
-        Vecd *pos_0 = std::get<0>(particles);
-        Real *volume = std::get<1>(particles);
+        Vecd *pos_0 = std::get<0>(particles[i]).data();
+        Real *volume = std::get<1>(particles[i]).data();
 
         // create the SolidBodyForSimulation
         solid_body_list_.emplace_back(makeShared<SolidBodyForSimulation>(
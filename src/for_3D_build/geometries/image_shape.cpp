@@ -7,21 +7,7 @@ namespace SPH
 //=================================================================================================//
 bool ImageShape::checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED)
 {
-    Real value = image_->findValueAtPoint(probe_point);
-    if (BOUNDARY_INCLUDED == true)
-    {
-        if (value > 0.0)
-            return false;
-        else
-            return true;
-    }
-    else
-    {
-        if (value >= 0.0)
-            return false;
-        else
-            return true;
-    }
+    return image_->checkContain(probe_point, BOUNDARY_INCLUDED);
 }
 //=================================================================================================//
 Vecd ImageShape::findClosestPoint(const Vecd &probe_point)
@@ -35,10 +21,10 @@ BoundingBox ImageShape::findBounds()
 }
 //=================================================================================================//
 ImageShapeFromFile::
-    ImageShapeFromFile(const std::string &file_path_name, const std::string &shape_name)
+    ImageShapeFromFile(const std::string &file_path_name, const std::string &shape_name, size_t memory_budget)
     : ImageShape(shape_name)
 {
-    image_.reset(new ImageMHD<float, 3>(file_path_name));
+    image_.reset(new ImageMHD<float, 3>(file_path_name, memory_budget));
 }
 //=================================================================================================//
 ImageShapeSphere::
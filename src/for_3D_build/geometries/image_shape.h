@@ -65,8 +65,10 @@ class ImageShape : public Shape
 class ImageShapeFromFile : public ImageShape
 {
   public:
+    /** Images larger than the memory budget (in bytes) are paged from the raw file. */
     explicit ImageShapeFromFile(const std::string &file_path_name,
-                                const std::string &shape_name = "ImageShapeFromFile");
+                                const std::string &shape_name = "ImageShapeFromFile",
+                                size_t memory_budget = size_t(1) << 30);
     virtual ~ImageShapeFromFile(){};
 };
 
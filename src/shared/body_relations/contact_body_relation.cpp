@@ -2,10 +2,50 @@
 #include "all_particles.h"
 #include "base_particle_dynamics.h"
 #include "cell_linked_list.hpp"
+#include "particle_functors.h"
 
 namespace SPH
 {
 //=================================================================================================//
+template <class DynamicsRange>
+BoundingBox ContactRelationCrossResolution::reduceParticleBounds(DynamicsRange &dynamics_range)
+{
+    Vecd *pos = dynamics_range.getBaseParticles().ParticlePositions();
+    ReduceBoundingBox reduce_bounding_box;
+    return particle_reduce(execution::ParallelPolicy(), dynamics_range.LoopRange(),
+                           reduce_bounding_box.reference_, reduce_bounding_box,
+                           [&](size_t index_i)
+                           { return BoundingBox(pos[index_i], pos[index_i]); });
+}
+//=================================================================================================//
+BoundingBox ContactRelationCrossResolution::reduceContactBodyBounds(size_t k)
+{
+    BaseParticles &particles = *contact_particles_[k];
+    Vecd *pos = particles.ParticlePositions();
+    ReduceBoundingBox reduce_bounding_box;
+    auto particle_bounds = [&](size_t index_i)
+    { return BoundingBox(pos[index_i], pos[index_i]); };
+    BoundingBox real_bounds =
+        particle_reduce(execution::ParallelPolicy(), IndexRange(0, particles.TotalRealParticles()),
+                        reduce_bounding_box.reference_, reduce_bounding_box, particle_bounds);
+    // ghost particles are inserted in the cell linked list too, unused ghosts only enlarge the bounds
+    BoundingBox ghost_bounds =
+        particle_reduce(execution::ParallelPolicy(), IndexRange(particles.RealParticlesBound(), particles.ParticlesBound()),
+                        reduce_bounding_box.reference_, reduce_bounding_box, particle_bounds);
+    return reduce_bounding_box(real_bounds, ghost_bounds);
+}
+//=================================================================================================//
+bool ContactRelationCrossResolution::getContactSearchBounds(
+    size_t k, const BoundingBox &source_bounds, BoundingBox &search_bounds)
+{
+    // a particle only searches the cells within this distance in each direction
+    Real search_range = Real(get_search_depths_[k]->search_depth_ + 1) * target_cell_linked_lists_[k]->GridSpacing();
+    BoundingBox contact_bounds = reduceContactBodyBounds(k);
+    search_bounds.first_ = source_bounds.first_.cwiseMax(contact_bounds.first_ - search_range * Vecd::Ones());
+    search_bounds.second_ = source_bounds.second_.cwiseMin(contact_bounds.second_ + search_range * Vecd::Ones());
+    return (search_bounds.first_.array() <= search_bounds.second_.array()).all();
+}
+//=================================================================================================//
 ContactRelation::ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies)
     : ContactRelationCrossResolution(sph_body, contact_bodies)
 {
@@ -20,11 +60,16 @@ ContactRelation::ContactRelation(SPHBody &sph_body, RealBodyVector contact_bodie
 void ContactRelation::updateConfiguration()
 {
     resetNeighborhoodCurrentSize();
+    BoundingBox source_bounds = reduceParticleBounds(sph_body_);
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
-        target_cell_linked_lists_[k]->searchNeighborsByParticles(
-            sph_body_, contact_configuration_[k],
-            *get_search_depths_[k], *get_contact_neighbors_[k]);
+        BoundingBox search_bounds;
+        if (getContactSearchBounds(k, source_bounds, search_bounds))
+        {
+            target_cell_linked_lists_[k]->searchNeighborsByParticles(
+                sph_body_, contact_configuration_[k],
+                *get_search_depths_[k], *get_contact_neighbors_[k], search_bounds);
+        }
     }
 }
 //=================================================================================================//
@@ -234,11 +279,16 @@ void SurfaceContactRelation::resetNeighborhoodCurrentSize()
 void SurfaceContactRelation::updateConfiguration()
 {
     resetNeighborhoodCurrentSize();
+    BoundingBox source_bounds = reduceParticleBounds(*body_surface_layer_);
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
-        target_cell_linked_lists_[k]->searchNeighborsByParticles(
-            *body_surface_layer_, contact_configuration_[k],
-            *get_search_depths_[k], *get_contact_neighbors_[k]);
+        BoundingBox search_bounds;
+        if (getContactSearchBounds(k, source_bounds, search_bounds))
+        {
+            target_cell_linked_lists_[k]->searchNeighborsByParticles(
+                *body_surface_layer_, contact_configuration_[k],
+                *get_search_depths_[k], *get_contact_neighbors_[k], search_bounds);
+        }
     }
 }
 //=================================================================================================//
@@ -66,6 +66,15 @@ class ContactRelationCrossResolution : public BaseContactRelation
   protected:
     StdVec<CellLinkedList *> target_cell_linked_lists_;
     StdVec<SearchDepthContact *> get_search_depths_;
+
+    /** Broad phase: the bounds of the particles in a dynamics range by reduction. */
+    template <class DynamicsRange>
+    BoundingBox reduceParticleBounds(DynamicsRange &dynamics_range);
+    /** The bounds of the particles of a contact body, including its ghost particles. */
+    BoundingBox reduceContactBodyBounds(size_t k);
+    /** Obtain the region in which the source particles may have neighbors from the contact body.
+     *  Returns false if the source bounds and the contact bounds, enlarged by the cell search range, do not overlap. */
+    bool getContactSearchBounds(size_t k, const BoundingBox &source_bounds, BoundingBox &search_bounds);
 };
 
 /**
@@ -61,7 +61,16 @@ using DataAssemble = std::tuple<KeeperType<ContainerType<UnsignedInt>>,
                                 KeeperType<ContainerType<Vec2d>>,
                                 KeeperType<ContainerType<Mat2d>>,
                                 KeeperType<ContainerType<Vec3d>>,
+#if SPHINXSYS_USE_MIXED_PRECISION
+                                KeeperType<ContainerType<Mat3d>>,
+                                KeeperType<ContainerType<StorageReal>>,
+                                KeeperType<ContainerType<StorageVec2d>>,
+                                KeeperType<ContainerType<StorageMat2d>>,
+                                KeeperType<ContainerType<StorageVec3d>>,
+                                KeeperType<ContainerType<StorageMat3d>>>;
+#else
                                 KeeperType<ContainerType<Mat3d>>>;
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 /** Generalized data container assemble type */
 template <template <typename> typename ContainerType>
 using DataContainerAssemble = DataAssemble<DataContainerKeeper, ContainerType>;
@@ -73,6 +73,19 @@ using Mat3d = Eigen::Matrix<Real, 3, 3>;
 /** Dynamic matrix*/
 using MatXd = Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>;
 
+/** Storage precision of particle fields. In the mixed-precision build,
+ *  positions, time and reductions are kept in Real (double) while the fields
+ *  registered with storage types are kept in float and converted in the kernels. */
+#if SPHINXSYS_USE_MIXED_PRECISION
+using StorageReal = float;
+#else
+using StorageReal = Real;
+#endif // SPHINXSYS_USE_MIXED_PRECISION
+using StorageVec2d = Eigen::Matrix<StorageReal, 2, 1>;
+using StorageVec3d = Eigen::Matrix<StorageReal, 3, 1>;
+using StorageMat2d = Eigen::Matrix<StorageReal, 2, 2>;
+using StorageMat3d = Eigen::Matrix<StorageReal, 3, 3>;
+
 /** Unified initialize to zero for all data type. */
 template <typename DataType>
 struct ZeroData
@@ -90,6 +103,13 @@ struct ZeroData<Real>
 {
     static inline Real value = Real(0);
 };
+#if SPHINXSYS_USE_MIXED_PRECISION
+template <>
+struct ZeroData<StorageReal>
+{
+    static inline StorageReal value = StorageReal(0);
+};
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 template <>
 struct ZeroData<int>
 {
@@ -149,6 +169,33 @@ struct DataTypeIndex<Mat3d>
 {
     static constexpr int value = 6;
 };
+#if SPHINXSYS_USE_MIXED_PRECISION
+template <>
+struct DataTypeIndex<StorageReal>
+{
+    static constexpr int value = 7;
+};
+template <>
+struct DataTypeIndex<StorageVec2d>
+{
+    static constexpr int value = 8;
+};
+template <>
+struct DataTypeIndex<StorageMat2d>
+{
+    static constexpr int value = 9;
+};
+template <>
+struct DataTypeIndex<StorageVec3d>
+{
+    static constexpr int value = 10;
+};
+template <>
+struct DataTypeIndex<StorageMat3d>
+{
+    static constexpr int value = 11;
+};
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 
 /** Verbal boolean for positive and negative axis directions. */
 const int xAxis = 0;
@@ -0,0 +1,301 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	batched_tensor.h
+ * @brief 	Batched small-matrix kernels for particle blocks.
+ * @details The matrices of a block of particles are stored in structure-of-arrays form,
+ *          i.e. each matrix entry is an array over the lanes of the batch.
+ *          All kernels loop over the lanes innermost without branches,
+ *          so that the loops are vectorized with the instruction set chosen by SPHINXSYS_USE_SIMD.
+ *          The lane number follows the SIMD width, 8 for AVX-512 and 4 otherwise.
+ *          The polar decomposition is computed by the scaled Newton iteration,
+ *          whose steps are the same for all lanes and stop when all lanes have converged.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef BATCHED_TENSOR_H
+#define BATCHED_TENSOR_H
+
+#include "vector_functions.h"
+
+namespace SPH
+{
+#if defined(__AVX512F__)
+constexpr int BatchLanes = 8;
+#else
+constexpr int BatchLanes = 4;
+#endif
+
+template <int Lanes = BatchLanes>
+struct BatchedReal
+{
+    alignas(8 * sizeof(Real)) Real lane_[Lanes];
+
+    Real &operator[](int l) { return lane_[l]; };
+    const Real &operator[](int l) const { return lane_[l]; };
+};
+
+template <int Lanes = BatchLanes>
+struct BatchedMatd
+{
+    alignas(8 * sizeof(Real)) Real entry_[Dimensions][Dimensions][Lanes];
+
+    Real *operator()(int i, int j) { return entry_[i][j]; };
+    const Real *operator()(int i, int j) const { return entry_[i][j]; };
+
+    /** Gather the matrices of the particles [begin, begin + size), size <= Lanes.
+     *  The unused lanes are filled with identity to keep all kernels well defined. */
+    void load(const Matd *matrices, size_t begin, int size)
+    {
+        for (int i = 0; i != Dimensions; ++i)
+            for (int j = 0; j != Dimensions; ++j)
+            {
+                for (int l = 0; l != size; ++l)
+                    entry_[i][j][l] = matrices[begin + l](i, j);
+                for (int l = size; l != Lanes; ++l)
+                    entry_[i][j][l] = i == j ? 1.0 : 0.0;
+            }
+    };
+
+    void store(Matd *matrices, size_t begin, int size) const
+    {
+        for (int l = 0; l != size; ++l)
+            for (int i = 0; i != Dimensions; ++i)
+                for (int j = 0; j != Dimensions; ++j)
+                    matrices[begin + l](i, j) = entry_[i][j][l];
+    };
+
+    Matd lane(int l) const
+    {
+        Matd matrix;
+        for (int i = 0; i != Dimensions; ++i)
+            for (int j = 0; j != Dimensions; ++j)
+                matrix(i, j) = entry_[i][j][l];
+        return matrix;
+    };
+};
+
+/** C = A * B */
+template <int Lanes>
+inline void batchedProduct(const BatchedMatd<Lanes> &A, const BatchedMatd<Lanes> &B, BatchedMatd<Lanes> &C)
+{
+    for (int i = 0; i != Dimensions; ++i)
+        for (int j = 0; j != Dimensions; ++j)
+        {
+            Real *c = C(i, j);
+            for (int l = 0; l != Lanes; ++l)
+                c[l] = 0.0;
+            for (int k = 0; k != Dimensions; ++k)
+            {
+                const Real *a = A(i, k);
+                const Real *b = B(k, j);
+                for (int l = 0; l != Lanes; ++l)
+                    c[l] += a[l] * b[l];
+            }
+        }
+}
+
+/** C = A * B^T */
+template <int Lanes>
+inline void batchedProductTransposed(const BatchedMatd<Lanes> &A, const BatchedMatd<Lanes> &B, BatchedMatd<Lanes> &C)
+{
+    for (int i = 0; i != Dimensions; ++i)
+        for (int j = 0; j != Dimensions; ++j)
+        {
+            Real *c = C(i, j);
+            for (int l = 0; l != Lanes; ++l)
+                c[l] = 0.0;
+            for (int k = 0; k != Dimensions; ++k)
+            {
+                const Real *a = A(i, k);
+                const Real *b = B(j, k);
+                for (int l = 0; l != Lanes; ++l)
+                    c[l] += a[l] * b[l];
+            }
+        }
+}
+
+/** C = A^T * B */
+template <int Lanes>
+inline void batchedTransposedProduct(const BatchedMatd<Lanes> &A, const BatchedMatd<Lanes> &B, BatchedMatd<Lanes> &C)
+{
+    for (int i = 0; i != Dimensions; ++i)
+        for (int j = 0; j != Dimensions; ++j)
+        {
+            Real *c = C(i, j);
+            for (int l = 0; l != Lanes; ++l)
+                c[l] = 0.0;
+            for (int k = 0; k != Dimensions; ++k)
+            {
+                const Real *a = A(k, i);
+                const Real *b = B(k, j);
+                for (int l = 0; l != Lanes; ++l)
+                    c[l] += a[l] * b[l];
+            }
+        }
+}
+
+/** squared Frobenius norm, which is also the trace of A * A^T */
+template <int Lanes>
+inline void batchedSquaredNorm(const BatchedMatd<Lanes> &A, BatchedReal<Lanes> &result)
+{
+    for (int l = 0; l != Lanes; ++l)
+        result[l] = 0.0;
+    for (int i = 0; i != Dimensions; ++i)
+        for (int j = 0; j != Dimensions; ++j)
+        {
+            const Real *a = A(i, j);
+            for (int l = 0; l != Lanes; ++l)
+                result[l] += a[l] * a[l];
+        }
+}
+
+/** cofactor matrix, i.e. det(A) * A^{-T} */
+template <int Lanes>
+inline void batchedCofactor(const BatchedMatd<Lanes> &A, BatchedMatd<Lanes> &C)
+{
+    if constexpr (Dimensions == 2)
+    {
+        for (int l = 0; l != Lanes; ++l)
+        {
+            C(0, 0)[l] = A(1, 1)[l];
+            C(0, 1)[l] = -A(1, 0)[l];
+            C(1, 0)[l] = -A(0, 1)[l];
+            C(1, 1)[l] = A(0, 0)[l];
+        }
+    }
+    else
+    {
+        for (int i = 0; i != 3; ++i)
+            for (int j = 0; j != 3; ++j)
+            {
+                const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+                const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+                const Real *a11 = A(i1, j1), *a22 = A(i2, j2), *a12 = A(i1, j2), *a21 = A(i2, j1);
+                Real *c = C(i, j);
+                for (int l = 0; l != Lanes; ++l)
+                    c[l] = a11[l] * a22[l] - a12[l] * a21[l];
+            }
+    }
+}
+
+/** determinant from the cofactor matrix, expanded along the first row */
+template <int Lanes>
+inline void batchedDeterminant(const BatchedMatd<Lanes> &A, const BatchedMatd<Lanes> &cofactor,
+                               BatchedReal<Lanes> &determinant)
+{
+    for (int l = 0; l != Lanes; ++l)
+        determinant[l] = 0.0;
+    for (int j = 0; j != Dimensions; ++j)
+    {
+        const Real *a = A(0, j);
+        const Real *c = cofactor(0, j);
+        for (int l = 0; l != Lanes; ++l)
+            determinant[l] += a[l] * c[l];
+    }
+}
+
+/** A^{-T} and det(A) */
+template <int Lanes>
+inline void batchedInverseTranspose(const BatchedMatd<Lanes> &A, BatchedMatd<Lanes> &inverse_transpose,
+                                    BatchedReal<Lanes> &determinant)
+{
+    batchedCofactor(A, inverse_transpose);
+    batchedDeterminant(A, inverse_transpose, determinant);
+    BatchedReal<Lanes> inverse_determinant;
+    for (int l = 0; l != Lanes; ++l)
+        inverse_determinant[l] = 1.0 / determinant[l];
+    for (int i = 0; i != Dimensions; ++i)
+        for (int j = 0; j != Dimensions; ++j)
+        {
+            Real *c = inverse_transpose(i, j);
+            for (int l = 0; l != Lanes; ++l)
+                c[l] *= inverse_determinant[l];
+        }
+}
+
+/**
+ * Polar decomposition A = Q * H with Q orthogonal and H symmetric positive semi-definite,
+ * for matrices with positive determinant.
+ * Scaled Newton iteration: X_{k+1} = (gamma X_k + X_k^{-T} / gamma) / 2,
+ * gamma = (|X_k^{-1}| / |X_k|)^{1/2} in the Frobenius norm.
+ * Ref. N. J. Higham, Functions of Matrices: Theory and Computation, SIAM, 2008, Chapter 8.
+ */
+template <int Lanes>
+inline void batchedPolarDecomposition(const BatchedMatd<Lanes> &A, BatchedMatd<Lanes> &Q, BatchedMatd<Lanes> &H,
+                                      Real tolerance = 1.0e-12, int max_iterations = 20)
+{
+    Q = A;
+    BatchedMatd<Lanes> inverse_transpose;
+    BatchedReal<Lanes> determinant, norm_squared, inverse_norm_squared, change_squared;
+    for (int k = 0; k != max_iterations; ++k)
+    {
+        batchedInverseTranspose(Q, inverse_transpose, determinant);
+        batchedSquaredNorm(Q, norm_squared);
+        batchedSquaredNorm(inverse_transpose, inverse_norm_squared);
+
+        BatchedReal<Lanes> gamma, inverse_gamma;
+        for (int l = 0; l != Lanes; ++l)
+        {
+            gamma[l] = std::sqrt(std::sqrt(inverse_norm_squared[l] / norm_squared[l]));
+            inverse_gamma[l] = 1.0 / gamma[l];
+            change_squared[l] = 0.0;
+        }
+
+        for (int i = 0; i != Dimensions; ++i)
+            for (int j = 0; j != Dimensions; ++j)
+            {
+                Real *q = Q(i, j);
+                const Real *q_inverse_transpose = inverse_transpose(i, j);
+                for (int l = 0; l != Lanes; ++l)
+                {
+                    Real q_new = 0.5 * (gamma[l] * q[l] + inverse_gamma[l] * q_inverse_transpose[l]);
+                    change_squared[l] += (q_new - q[l]) * (q_new - q[l]);
+                    q[l] = q_new;
+                }
+            }
+
+        // the orthogonal factor has the norm of sqrt(Dimensions)
+        Real max_change_squared = 0.0;
+        for (int l = 0; l != Lanes; ++l)
+            max_change_squared = SMAX(max_change_squared, change_squared[l]);
+        if (max_change_squared < tolerance * tolerance * Real(Dimensions))
+            break;
+    }
+
+    batchedTransposedProduct(Q, A, H);
+    for (int i = 0; i != Dimensions; ++i)
+        for (int j = i + 1; j != Dimensions; ++j)
+        {
+            Real *h_ij = H(i, j);
+            Real *h_ji = H(j, i);
+            for (int l = 0; l != Lanes; ++l)
+            {
+                Real average = 0.5 * (h_ij[l] + h_ji[l]);
+                h_ij[l] = average;
+                h_ji[l] = average;
+            }
+        }
+}
+} // namespace SPH
+#endif // BATCHED_TENSOR_H
@@ -49,7 +49,7 @@ class BaseBoundingBox
     BaseBoundingBox(const VecType &lower_bound, const VecType &upper_bound)
         : first_(lower_bound), second_(upper_bound), dimension_(lower_bound.size()){};
     /** Check the bounding box contain. */
-    bool checkContain(const VecType &point)
+    bool checkContain(const VecType &point) const
     {
         bool is_contain = true;
         for (int i = 0; i < dimension_; ++i)
@@ -34,6 +34,8 @@
 #include "sphinxsys_containers.h"
 #include "vector_functions.h"
 
+#include "tbb/enumerable_thread_specific.h"
+
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -54,13 +56,22 @@ enum Output_Mode
     ASCII
 };
 
+/**
+ * @class ImageMHD
+ * @brief Image in MetaImage format. A raw file larger than the memory budget
+ * is not loaded as a whole but paged in slabs of z-slices on demand.
+ * Each thread keeps its own resident slabs so that voxel reads need no locking.
+ * For a paged image, the signed-distance bounds of coarse voxel blocks are precomputed
+ * and stored alongside the raw file, so that containment far from the surface
+ * is decided without paging and the next load does not scan the whole image again.
+ */
 template <typename T, int nDims>
 class ImageMHD
 {
   public:
     ImageMHD(){};
     // constructor for input files
-    explicit ImageMHD(std::string full_path_file);
+    explicit ImageMHD(std::string full_path_file, size_t memory_budget = size_t(1) << 30);
     // constructor for sphere
     ImageMHD(Real radius, Array3i dxdydz, Vec3d spacings);
     ~ImageMHD();
@@ -115,9 +126,11 @@ class ImageMHD
         elementDataFile_ = elementDataFile;
     };
 
+    /** Returns nullptr when the image is paged from the raw file. */
     T *get_data() { return data_; };
+    bool isPaged() { return data_ == nullptr && number_of_slabs_ != 0; };
 
-    int get_size() { return size_; }
+    size_t get_size() { return size_; }
 
     Real get_min_value() { return min_value_; };
     Real get_max_value() { return max_value_; };
@@ -126,6 +139,7 @@ class ImageMHD
     BoundingBox findBounds();
     Real findValueAtPoint(const Vec3d &probe_point);
     Vec3d findNormalAtPoint(const Vec3d &probe_point);
+    bool checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED = true);
 
     void write(std::string filename, Output_Mode = BINARY);
 
@@ -143,18 +157,45 @@ class ImageMHD
     int width_;
     int height_;
     int depth_;
-    int size_;
+    size_t size_;
     std::string anatomicalOrientation_;
     Image_Data_Type elementType_;
     std::string elementDataFile_;
     Real min_value_;
     Real max_value_;
-    T *data_;
-
-    std::vector<int> findNeighbors(const Vec3d &probe_point, Array3i &this_cell);
-    Vec3d computeGradientAtCell(int i);
-    Vec3d computeNormalAtCell(int i);
-    T getValueAtCell(int i);
+    T *data_ = nullptr;
+    /** Paging of the raw file in slabs of slab_depth_ z-slices. */
+    struct SlabCache
+    {
+        std::ifstream raw_file_;
+        StdVec<size_t> slab_index_;
+        StdVec<StdVec<T>> slab_data_;
+        size_t next_eviction_ = 0;
+        size_t last_slab_ = MaxSize_t;
+        const T *last_slab_data_ = nullptr;
+    };
+    std::string raw_file_path_;
+    size_t slab_depth_ = 0;
+    size_t slab_size_ = 0;
+    size_t number_of_slabs_ = 0;
+    size_t max_resident_slabs_ = 0; /**< per thread */
+    tbb::enumerable_thread_specific<SlabCache> slab_caches_;
+    /** Signed-distance bounds of blocks of block_size_ voxels in each direction. */
+    int block_size_ = 8;
+    Array3i number_of_blocks_ = Array3i::Zero();
+    StdVec<float> block_lower_bound_;
+    StdVec<float> block_upper_bound_;
+
+    void setupSlabPaging(size_t memory_budget);
+    const T *loadSlab(SlabCache &slab_cache, size_t slab);
+    void readSlab(std::ifstream &raw_file, size_t slab, StdVec<T> &slab_data);
+    void precomputeBlockBounds();
+    void computeBlockBounds();
+    int findSignAtPoint(const Vec3d &probe_point);
+    std::vector<size_t> findNeighbors(const Vec3d &probe_point, Array3i &this_cell);
+    Vec3d computeGradientAtCell(size_t i);
+    Vec3d computeNormalAtCell(size_t i);
+    T getValueAtCell(size_t i);
     Vec3d convertToPhysicalSpace(Vec3d p);
     void split(const std::string &s, char delim, std::vector<std::string> &elems);
 };
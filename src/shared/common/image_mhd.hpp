@@ -12,11 +12,17 @@
 #include "boost/algorithm/string.hpp"
 #include "image_mhd.h"
 
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+
 namespace SPH
 {
 
 template <typename T, int nDims>
-ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
+ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file, size_t memory_budget)
     : objectType_("Image"),
       nDims_(nDims),
       binaryData_(true),
@@ -30,7 +36,7 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
       width_(dimSize_[0]),
       height_(dimSize_[1]),
       depth_(dimSize_[2]),
-      size_(dimSize_[0] * dimSize_[1] * dimSize_[2]),
+      size_(size_t(dimSize_[0]) * size_t(dimSize_[1]) * size_t(dimSize_[2])),
       anatomicalOrientation_("???"),
       elementType_(MET_FLOAT),
       elementDataFile_(""),
@@ -94,9 +100,7 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
                     width_ = dimSize_[0];
                     height_ = dimSize_[1];
                     depth_ = dimSize_[2];
-                    size_ = width_ * height_ * depth_;
-                    if (data_ == nullptr)
-                        data_ = new T[dimSize_[0] * dimSize_[1] * dimSize_[2]];
+                    size_ = size_t(width_) * size_t(height_) * size_t(depth_);
                 }
                 else if (elements[0].compare("ElementDataFile") == 0)
                 {
@@ -113,14 +117,24 @@ ImageMHD<T, nDims>::ImageMHD(std::string full_path_to_file)
     std::cout << "offset: " << offset_ << std::endl;
     std::cout << "transformMatrix: " << transformMatrix_ << std::endl;
 
+    //- page a raw file beyond the memory budget instead of loading it
+    raw_file_path_ = file_path_to_raw_file;
+    if (sizeof(T) * size_ > memory_budget)
+    {
+        setupSlabPaging(memory_budget);
+        precomputeBlockBounds();
+        return;
+    }
+
     //- read raw file
+    data_ = new T[size_];
     std::ifstream dataFileRaw(file_path_to_raw_file, std::ios::in | std::ios::binary);
 
     if (dataFileRaw.is_open())
     {
         dataFileRaw.read((char *)data_, sizeof(T) * size_);
         T distance = 0;
-        for (int index = 0; index < size_; index++)
+        for (size_t index = 0; index < size_; index++)
         {
             distance = data_[index];
             data_[index] = distance;
@@ -150,7 +164,7 @@ ImageMHD<T, nDims>::ImageMHD(Real radius, Array3i NxNyNz, Vec3d spacings)
       width_(dimSize_[0]),
       height_(dimSize_[1]),
       depth_(dimSize_[2]),
-      size_(width_ * height_ * depth_),
+      size_(size_t(width_) * size_t(height_) * size_t(depth_)),
       anatomicalOrientation_("???"),
       elementType_(MET_FLOAT),
       elementDataFile_(""),
@@ -169,7 +183,7 @@ ImageMHD<T, nDims>::ImageMHD(Real radius, Array3i NxNyNz, Vec3d spacings)
         {
             for (int x = 0; x < width_; x++)
             {
-                int index = z * width_ * height_ + y * width_ + x;
+                size_t index = (size_t(z) * height_ + y) * width_ + x;
                 Real distance = (Vecd(x, y, z) - center).norm() - radius;
                 if (distance < min_value_)
                     min_value_ = distance;
@@ -187,16 +201,200 @@ ImageMHD<T, nDims>::~ImageMHD()
 {
     if (data_)
     {
-        delete data_;
+        delete[] data_;
         data_ = nullptr;
     }
 }
 
 //=================================================================================================//
 template <typename T, int nDims>
-std::vector<int> ImageMHD<T, nDims>::findNeighbors(const Vec3d &probe_point, Array3i &this_cell)
+void ImageMHD<T, nDims>::setupSlabPaging(size_t memory_budget)
+{
+    //- the memory budget is shared by the slab caches of all threads
+    size_t number_of_threads = size_t(tbb::this_task_arena::max_concurrency());
+    size_t slice_size = size_t(width_) * size_t(height_);
+    size_t slice_bytes = sizeof(T) * slice_size;
+    size_t slab_bytes = std::max(slice_bytes, memory_budget / (4 * number_of_threads));
+    slab_depth_ = std::min(size_t(depth_), slab_bytes / slice_bytes);
+    slab_size_ = slice_size * slab_depth_;
+    number_of_slabs_ = (size_t(depth_) + slab_depth_ - 1) / slab_depth_;
+    max_resident_slabs_ = std::max(size_t(2), memory_budget / (number_of_threads * sizeof(T) * slab_size_));
+
+    std::ifstream raw_file(raw_file_path_, std::ios::in | std::ios::binary);
+    if (!raw_file.is_open())
+    {
+        std::cout << "\n Error: the raw image file " << raw_file_path_ << " is not found!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    std::cout << "paging image in " << number_of_slabs_ << " slabs of "
+              << slab_depth_ << " slices" << std::endl;
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::readSlab(std::ifstream &raw_file, size_t slab, StdVec<T> &slab_data)
+{
+    size_t slice_size = size_t(width_) * size_t(height_);
+    size_t first_slice = slab * slab_depth_;
+    size_t number_of_slices = std::min(slab_depth_, size_t(depth_) - first_slice);
+    slab_data.resize(slice_size * number_of_slices);
+    raw_file.clear();
+    raw_file.seekg(std::streamoff(sizeof(T) * slice_size * first_slice));
+    raw_file.read((char *)slab_data.data(), sizeof(T) * slab_data.size());
+}
+//=================================================================================================//
+template <typename T, int nDims>
+const T *ImageMHD<T, nDims>::loadSlab(SlabCache &slab_cache, size_t slab)
+{
+    if (!slab_cache.raw_file_.is_open())
+        slab_cache.raw_file_.open(raw_file_path_, std::ios::in | std::ios::binary);
+
+    StdVec<size_t> &slab_index = slab_cache.slab_index_;
+    size_t resident = std::find(slab_index.begin(), slab_index.end(), slab) - slab_index.begin();
+    if (resident == slab_index.size())
+    {
+        if (resident < max_resident_slabs_)
+        {
+            slab_index.push_back(slab);
+            slab_cache.slab_data_.emplace_back();
+        }
+        else // the slab loaded first is replaced
+        {
+            resident = slab_cache.next_eviction_;
+            slab_cache.next_eviction_ = (resident + 1) % max_resident_slabs_;
+            slab_index[resident] = slab;
+        }
+        readSlab(slab_cache.raw_file_, slab, slab_cache.slab_data_[resident]);
+    }
+    slab_cache.last_slab_ = slab;
+    slab_cache.last_slab_data_ = slab_cache.slab_data_[resident].data();
+    return slab_cache.last_slab_data_;
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::precomputeBlockBounds()
+{
+    number_of_blocks_ = (dimSize_ + Array3i::Constant(block_size_ - 1)) / block_size_;
+    size_t number_of_blocks =
+        size_t(number_of_blocks_[0]) * size_t(number_of_blocks_[1]) * size_t(number_of_blocks_[2]);
+
+    //- the precompute stored alongside the raw file is reused if it is not older
+    namespace fs = std::filesystem;
+    std::string bounds_file_path = raw_file_path_ + ".sdf";
+    std::error_code error;
+    if (fs::exists(bounds_file_path, error) &&
+        fs::last_write_time(bounds_file_path, error) >= fs::last_write_time(raw_file_path_, error))
+    {
+        std::ifstream bounds_file(bounds_file_path, std::ios::in | std::ios::binary);
+        int header[4] = {0, 0, 0, 0};
+        float value_range[2] = {0.0f, 0.0f};
+        bounds_file.read((char *)header, sizeof(header));
+        bounds_file.read((char *)value_range, sizeof(value_range));
+        if (!bounds_file.fail() && header[0] == width_ && header[1] == height_ &&
+            header[2] == depth_ && header[3] == block_size_)
+        {
+            block_lower_bound_.resize(number_of_blocks);
+            block_upper_bound_.resize(number_of_blocks);
+            bounds_file.read((char *)block_lower_bound_.data(), sizeof(float) * number_of_blocks);
+            bounds_file.read((char *)block_upper_bound_.data(), sizeof(float) * number_of_blocks);
+            if (!bounds_file.fail())
+            {
+                min_value_ = value_range[0];
+                max_value_ = value_range[1];
+                return;
+            }
+        }
+    }
+
+    computeBlockBounds();
+
+    std::ofstream bounds_file(bounds_file_path, std::ios::out | std::ios::binary);
+    int header[4] = {width_, height_, depth_, block_size_};
+    float value_range[2] = {float(min_value_), float(max_value_)};
+    bounds_file.write((const char *)header, sizeof(header));
+    bounds_file.write((const char *)value_range, sizeof(value_range));
+    bounds_file.write((const char *)block_lower_bound_.data(), sizeof(float) * number_of_blocks);
+    bounds_file.write((const char *)block_upper_bound_.data(), sizeof(float) * number_of_blocks);
+}
+//=================================================================================================//
+template <typename T, int nDims>
+void ImageMHD<T, nDims>::computeBlockBounds()
+{
+    size_t number_of_blocks =
+        size_t(number_of_blocks_[0]) * size_t(number_of_blocks_[1]) * size_t(number_of_blocks_[2]);
+    block_lower_bound_.assign(number_of_blocks, std::numeric_limits<float>::max());
+    block_upper_bound_.assign(number_of_blocks, std::numeric_limits<float>::lowest());
+
+    size_t slice_size = size_t(width_) * size_t(height_);
+    std::ifstream raw_file(raw_file_path_, std::ios::in | std::ios::binary);
+    StdVec<T> slab_data;
+    for (size_t slab = 0; slab != number_of_slabs_; ++slab)
+    {
+        readSlab(raw_file, slab, slab_data);
+        for (size_t index = 0; index != slab_data.size(); ++index)
+        {
+            size_t z = slab * slab_depth_ + index / slice_size;
+            size_t y = (index % slice_size) / width_;
+            size_t x = index % width_;
+            size_t block = (z / block_size_ * number_of_blocks_[1] + y / block_size_) *
+                               number_of_blocks_[0] +
+                           x / block_size_;
+            float value = float(slab_data[index]);
+            block_lower_bound_[block] = SMIN(block_lower_bound_[block], value);
+            block_upper_bound_[block] = SMAX(block_upper_bound_[block], value);
+            min_value_ = SMIN(min_value_, Real(value));
+            max_value_ = SMAX(max_value_, Real(value));
+        }
+    }
+
+    //- widen the bounds by the neighboring blocks so that they also cover
+    //- the neighboring cells used by queries close to the block faces
+    size_t stride[3] = {1, size_t(number_of_blocks_[0]), size_t(number_of_blocks_[0]) * number_of_blocks_[1]};
+    for (int axis = 0; axis != 3; ++axis)
+    {
+        StdVec<float> lower_bound(block_lower_bound_);
+        StdVec<float> upper_bound(block_upper_bound_);
+        for (size_t block = 0; block != number_of_blocks; ++block)
+        {
+            size_t position = (block / stride[axis]) % size_t(number_of_blocks_[axis]);
+            if (position != 0)
+            {
+                block_lower_bound_[block] = SMIN(block_lower_bound_[block], lower_bound[block - stride[axis]]);
+                block_upper_bound_[block] = SMAX(block_upper_bound_[block], upper_bound[block - stride[axis]]);
+            }
+            if (position + 1 != size_t(number_of_blocks_[axis]))
+            {
+                block_lower_bound_[block] = SMIN(block_lower_bound_[block], lower_bound[block + stride[axis]]);
+                block_upper_bound_[block] = SMAX(block_upper_bound_[block], upper_bound[block + stride[axis]]);
+            }
+        }
+    }
+}
+//=================================================================================================//
+template <typename T, int nDims>
+int ImageMHD<T, nDims>::findSignAtPoint(const Vec3d &probe_point)
+{
+    Vec3d image_coord = transformMatrix_.inverse() * (probe_point - offset_);
+    int z = int(floor(image_coord[2]));
+    int y = int(floor(image_coord[1]));
+    int x = int(floor(image_coord[0]));
+    if (x < 0 || x > width_ - 1 || y < 0 || y > height_ - 1 || z < 0 || z > depth_ - 1)
+        return 0;
+
+    size_t block = (size_t(z / block_size_) * number_of_blocks_[1] + y / block_size_) *
+                       number_of_blocks_[0] +
+                   x / block_size_;
+    if (block_lower_bound_[block] > 0.0f)
+        return 1;
+    if (block_upper_bound_[block] < 0.0f)
+        return -1;
+    return 0;
+}
+//=================================================================================================//
+template <typename T, int nDims>
+std::vector<size_t> ImageMHD<T, nDims>::findNeighbors(const Vec3d &probe_point, Array3i &this_cell)
 {
-    std::vector<int> neighbors;
+    std::vector<size_t> neighbors;
 
     Vec3d image_coord = transformMatrix_.inverse() * (probe_point - offset_);
     // std::cout <<"findNeighbor of " << probe_point << " ........... " << image_coord << std::endl;
@@ -217,7 +415,7 @@ std::vector<int> ImageMHD<T, nDims>::findNeighbors(const Vec3d &probe_point, Arr
             {
                 if (i < 0 || i > width_ - 1 || j < 0 || j > height_ - 1 || k < 0 || k > depth_)
                     continue;
-                int index = z * width_ * height_ + y * width_ + x;
+                size_t index = (size_t(z) * height_ + y) * width_ + x;
                 neighbors.push_back(index);
             }
         }
@@ -227,16 +425,16 @@ std::vector<int> ImageMHD<T, nDims>::findNeighbors(const Vec3d &probe_point, Arr
 }
 //=================================================================================================//
 template <typename T, int nDims>
-Vec3d ImageMHD<T, nDims>::computeGradientAtCell(int i)
+Vec3d ImageMHD<T, nDims>::computeGradientAtCell(size_t i)
 {
     //- translate 1D index to 3D index
-    int width = width_;
-    int height = height_;
-    int depth = depth_;
-    int sliceSize = width * height;
-    int z = i / sliceSize;
-    int y = (i % sliceSize) / width;
-    int x = (i % sliceSize) % width;
+    size_t width = width_;
+    size_t height = height_;
+    size_t depth = depth_;
+    size_t sliceSize = width * height;
+    size_t z = i / sliceSize;
+    size_t y = (i % sliceSize) / width;
+    size_t x = (i % sliceSize) % width;
 
     Real grad_x = 0.0;
     Real grad_y = 0.0;
@@ -245,52 +443,52 @@ Vec3d ImageMHD<T, nDims>::computeGradientAtCell(int i)
     //- otherwise back/forward scheme
     if (x == 0)
     {
-        int indexHigh = z * sliceSize + y * width + (x + 1);
+        size_t indexHigh = z * sliceSize + y * width + (x + 1);
         grad_x = (getValueAtCell(indexHigh) - getValueAtCell(i));
     }
     else if (x == width - 1)
     {
-        int indexLow = z * sliceSize + y * width + (x - 1);
+        size_t indexLow = z * sliceSize + y * width + (x - 1);
         grad_x = -(getValueAtCell(indexLow) - getValueAtCell(i));
     }
-    else if (x > 0 && x < width_ - 1)
+    else if (x > 0 && x < width - 1)
     {
-        int indexHigh = z * sliceSize + y * width + (x + 1);
-        int indexLow = z * sliceSize + y * width + (x - 1);
+        size_t indexHigh = z * sliceSize + y * width + (x + 1);
+        size_t indexLow = z * sliceSize + y * width + (x - 1);
         grad_x = (getValueAtCell(indexHigh) - getValueAtCell(indexLow)) / 2.0;
     }
 
     if (y == 0)
     {
-        int indexHigh = z * sliceSize + (y + 1) * width + x;
+        size_t indexHigh = z * sliceSize + (y + 1) * width + x;
         grad_y = (getValueAtCell(indexHigh) - getValueAtCell(i));
     }
     else if (y == height - 1)
     {
-        int indexLow = z * sliceSize + (y - 1) * width + x;
+        size_t indexLow = z * sliceSize + (y - 1) * width + x;
         grad_y = -(getValueAtCell(indexLow) - getValueAtCell(i));
     }
-    else if (y > 0 && y < height_ - 1)
+    else if (y > 0 && y < height - 1)
     {
-        int indexHigh = z * sliceSize + (y + 1) * width + x;
-        int indexLow = z * sliceSize + (y - 1) * width + x;
+        size_t indexHigh = z * sliceSize + (y + 1) * width + x;
+        size_t indexLow = z * sliceSize + (y - 1) * width + x;
         grad_y = (getValueAtCell(indexHigh) - getValueAtCell(indexLow)) / 2.0;
     }
 
     if (z == 0)
     {
-        int indexHigh = (z + 1) * sliceSize + y * width + x;
+        size_t indexHigh = (z + 1) * sliceSize + y * width + x;
         grad_z = (getValueAtCell(indexHigh) - getValueAtCell(i));
     }
     else if (z == depth - 1)
     {
-        int indexLow = (z - 1) * sliceSize + y * width + x;
+        size_t indexLow = (z - 1) * sliceSize + y * width + x;
         grad_z = -(getValueAtCell(indexLow) - getValueAtCell(i));
     }
-    else if (z > 0 && z < depth_ - 1)
+    else if (z > 0 && z < depth - 1)
     {
-        int indexHigh = (z + 1) * sliceSize + y * width + x;
-        int indexLow = (z - 1) * sliceSize + y * width + x;
+        size_t indexHigh = (z + 1) * sliceSize + y * width + x;
+        size_t indexLow = (z - 1) * sliceSize + y * width + x;
         grad_z = (getValueAtCell(indexHigh) - getValueAtCell(indexLow)) / 2.0;
     }
     grad_x = grad_x / elementSpacing_[0];
@@ -300,7 +498,7 @@ Vec3d ImageMHD<T, nDims>::computeGradientAtCell(int i)
 }
 //=================================================================================================//
 template <typename T, int nDims>
-Vec3d ImageMHD<T, nDims>::computeNormalAtCell(int i)
+Vec3d ImageMHD<T, nDims>::computeNormalAtCell(size_t i)
 {
     Vec3d grad_phi = computeGradientAtCell(i);
     Vec3d n = grad_phi.normalized();
@@ -308,16 +506,23 @@ Vec3d ImageMHD<T, nDims>::computeNormalAtCell(int i)
 }
 
 template <typename T, int nDims>
-T ImageMHD<T, nDims>::getValueAtCell(int i)
+T ImageMHD<T, nDims>::getValueAtCell(size_t i)
 {
-    if (i < 0 || i > size_)
+    if (i >= size_)
     {
         return float(max_value_);
     }
-    else
+    else if (data_ != nullptr)
     {
         return data_[i];
     }
+    else
+    {
+        SlabCache &slab_cache = slab_caches_.local();
+        size_t slab = i / slab_size_;
+        const T *slab_data = slab == slab_cache.last_slab_ ? slab_cache.last_slab_data_ : loadSlab(slab_cache, slab);
+        return slab_data[i - slab * slab_size_];
+    }
 }
 //=================================================================================================//
 template <typename T, int nDims>
@@ -348,11 +553,11 @@ template <typename T, int nDims>
 Vec3d ImageMHD<T, nDims>::findClosestPoint(const Vec3d &probe_point)
 {
     Array3i this_cell = Array3i::Zero();
-    std::vector<int> neighbors = findNeighbors(probe_point, this_cell);
+    std::vector<size_t> neighbors = findNeighbors(probe_point, this_cell);
     Vec3d n_sum = Vecd::Zero();
     Real weight_sum = 0.0;
     Real d_sum = 0.0;
-    for (const int &i : neighbors)
+    for (const size_t &i : neighbors)
     {
         // checkIndexBound(i);
         Vec3d nCj = computeNormalAtCell(i);
@@ -377,11 +582,12 @@ BoundingBox ImageMHD<T, nDims>::findBounds()
     Vec3d lower_bound = MaxReal * Vec3d::Ones();
     Vec3d upper_bound = MinReal * Vec3d::Ones();
 
-    for (int z = 0; z < depth_ + 1; z++)
+    //- the mapping to physical space is affine, so the corners bound the image
+    for (int z : {0, depth_})
     {
-        for (int y = 0; y < height_ + 1; y++)
+        for (int y : {0, height_})
         {
-            for (int x = 0; x < width_ + 1; x++)
+            for (int x : {0, width_})
             {
                 Vec3d p_image = Vec3d(x, y, z);
                 Vec3d vertex_position = convertToPhysicalSpace(p_image);
@@ -400,12 +606,12 @@ template <typename T, int nDims>
 Real ImageMHD<T, nDims>::findValueAtPoint(const Vec3d &probe_point)
 {
     Array3i this_cell;
-    std::vector<int> neighbors = findNeighbors(probe_point, this_cell);
+    std::vector<size_t> neighbors = findNeighbors(probe_point, this_cell);
     Real weight_sum = 0.0;
     Real d_sum = 0.0;
     if (neighbors.size() > 0)
     {
-        for (const int &i : neighbors)
+        for (const size_t &i : neighbors)
         {
             // checkIndexBound(i);
             Real dCj = float(getValueAtCell(i));
@@ -425,13 +631,13 @@ template <typename T, int nDims>
 Vec3d ImageMHD<T, nDims>::findNormalAtPoint(const Vec3d &probe_point)
 {
     Array3i this_cell = Array3i::Zero();
-    std::vector<int> neighbors = findNeighbors(probe_point, this_cell);
+    std::vector<size_t> neighbors = findNeighbors(probe_point, this_cell);
     Vec3d n_sum = Vecd::Zero();
     Real weight_sum = 0.0;
     Real d_sum = 0.0;
     if (neighbors.size() > 0)
     {
-        for (const int &i : neighbors)
+        for (const size_t &i : neighbors)
         {
             // checkIndexBound(i);
             Vec3d nCj = computeNormalAtCell(i);
@@ -449,6 +655,18 @@ Vec3d ImageMHD<T, nDims>::findNormalAtPoint(const Vec3d &probe_point)
         return Vec3d::Ones();
     }
 }
+//=================================================================================================//
+template <typename T, int nDims>
+bool ImageMHD<T, nDims>::checkContain(const Vec3d &probe_point, bool BOUNDARY_INCLUDED)
+{
+    //- a block with definite sign decides without paging the image
+    int sign = isPaged() ? findSignAtPoint(probe_point) : 0;
+    if (sign != 0)
+        return sign < 0;
+
+    Real value = findValueAtPoint(probe_point);
+    return BOUNDARY_INCLUDED ? value <= 0.0 : value < 0.0;
+}
 
 //=================================================================================================//
 template <typename T, int nDims>
@@ -492,21 +710,32 @@ void ImageMHD<T, nDims>::write(std::string filename, Output_Mode mode)
 
     output_file.close();
 
-    if (mode == BINARY)
-    {
-        std::ofstream output_file_raw(filename + ".raw", std::ios::binary | std::ios::out);
-        output_file_raw.write((const char *)data_, sizeof(T) * size_);
-        output_file_raw.close();
-    }
-    else
+    //- a paged image is written slab by slab
+    std::ofstream output_file_raw(filename + ".raw", mode == BINARY ? std::ios::binary | std::ios::out : std::ios::out);
+    std::ifstream raw_file;
+    if (data_ == nullptr)
+        raw_file.open(raw_file_path_, std::ios::in | std::ios::binary);
+    StdVec<T> slab_data;
+    size_t number_of_blocks = data_ != nullptr ? 1 : number_of_slabs_;
+    for (size_t slab = 0; slab != number_of_blocks; ++slab)
     {
-        std::ofstream output_file_raw(filename + ".raw");
-        for (int index = 0; index < size_; index++)
+        if (data_ == nullptr)
+            readSlab(raw_file, slab, slab_data);
+        const T *block = data_ != nullptr ? data_ : slab_data.data();
+        size_t block_size = data_ != nullptr ? size_ : slab_data.size();
+        if (mode == BINARY)
+        {
+            output_file_raw.write((const char *)block, sizeof(T) * block_size);
+        }
+        else
         {
-            output_file_raw << data_[index] << std::endl;
+            for (size_t index = 0; index != block_size; ++index)
+            {
+                output_file_raw << block[index] << std::endl;
+            }
         }
-        output_file_raw.close();
     }
+    output_file_raw.close();
 }
 } // namespace SPH
 #endif //__EMSCRIPTEN__
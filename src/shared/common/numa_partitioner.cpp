@@ -0,0 +1,33 @@
+#include "numa_partitioner.h"
+
+#include <iostream>
+
+namespace SPH
+{
+//=================================================================================================//
+void NumaPartitioner::setActive(bool is_active)
+{
+    if (is_active && node_arenas_.empty())
+    {
+        std::vector<tbb::numa_node_id> numa_nodes = tbb::info::numa_nodes();
+        if (numa_nodes.size() > 1)
+        {
+            node_offsets_.push_back(0);
+            for (tbb::numa_node_id numa_node : numa_nodes)
+            {
+                node_arenas_.push_back(makeUnique<tbb::task_arena>(tbb::task_arena::constraints(numa_node)));
+                node_arenas_.back()->initialize();
+                node_partitioners_.push_back(makeUnique<tbb::affinity_partitioner>());
+                node_offsets_.push_back(node_offsets_.back() + node_arenas_.back()->max_concurrency());
+            }
+        }
+    }
+
+    is_active_ = is_active && node_arenas_.size() > 1;
+    if (is_active && !is_active_)
+    {
+        std::cout << "\n NUMA-affine partitioning is not activated as only one NUMA node is found." << std::endl;
+    }
+}
+//=================================================================================================//
+} // namespace SPH
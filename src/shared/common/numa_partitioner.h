@@ -0,0 +1,172 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	numa_partitioner.h
+ * @brief 	Optional socket-affine partitioning of parallel particle loops.
+ * @details When activated and more than one NUMA node is found, a particle range is split
+ *          into contiguous blocks, one for each NUMA node, proportional to the number of
+ *          threads of the node. Each block is processed in a task arena pinned to its node.
+ *          As particle data are initialized with the same partitioning, the pages of each
+ *          block are first touched, and therefore placed, on the node which later works on them.
+ *          Otherwise, the global affinity partitioner is used as before.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef NUMA_PARTITIONER_H
+#define NUMA_PARTITIONER_H
+
+#include "large_data_containers.h"
+#include "ownership.h"
+
+#include <tbb/info.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+namespace SPH
+{
+class NumaPartitioner
+{
+  public:
+    NumaPartitioner(NumaPartitioner const &) = delete;
+    void operator=(NumaPartitioner const &) = delete;
+    ~NumaPartitioner(){};
+
+    static NumaPartitioner &getInstance()
+    {
+        static NumaPartitioner instance;
+        return instance;
+    }
+
+    bool isActive() { return is_active_; };
+    /** Activation takes effect only if more than one NUMA node is found.
+     *  It should be set before particles are generated so that the first touch is socket-affine.
+     *  Note that the functions used to initialize particle variables are then called in parallel
+     *  and have to be thread safe. */
+    void setActive(bool is_active);
+    size_t NumberOfNodes() { return node_arenas_.size(); };
+
+    template <class LocalFunction>
+    void parallel_for(const IndexRange &range, const LocalFunction &local_function)
+    {
+        // nested loops stay in the arena of the calling node
+        if (isInNodeArena())
+        {
+            tbb::parallel_for(range, local_function, ap);
+            return;
+        }
+
+        size_t number_of_nodes = node_arenas_.size();
+        StdVec<tbb::task_group> node_tasks(number_of_nodes);
+        for (size_t k = 0; k != number_of_nodes; ++k)
+        {
+            IndexRange node_range = NodeRange(range, k);
+            if (!node_range.empty())
+            {
+                node_arenas_[k]->execute(
+                    [&, k, node_range]()
+                    {
+                        node_tasks[k].run(
+                            [&, k, node_range]()
+                            {
+                                tbb::parallel_for(
+                                    node_range,
+                                    [&](const IndexRange &r)
+                                    {
+                                        bool was_in_node_arena = isInNodeArena();
+                                        isInNodeArena() = true;
+                                        local_function(r);
+                                        isInNodeArena() = was_in_node_arena;
+                                    },
+                                    *node_partitioners_[k]);
+                            });
+                    });
+            }
+        }
+
+        for (size_t k = 0; k != number_of_nodes; ++k)
+        {
+            node_arenas_[k]->execute([&, k]()
+                                     { node_tasks[k].wait(); });
+        }
+    };
+
+  protected:
+    NumaPartitioner() : is_active_(false){};
+
+    bool is_active_;
+    StdVec<UniquePtr<tbb::task_arena>> node_arenas_;
+    StdVec<UniquePtr<tbb::affinity_partitioner>> node_partitioners_;
+    StdVec<size_t> node_offsets_; /**< accumulated thread counts, normalized by the last entry */
+
+    /** The contiguous block of the range for the k-th node. */
+    IndexRange NodeRange(const IndexRange &range, size_t k)
+    {
+        size_t size = range.size();
+        size_t total_threads = node_offsets_.back();
+        return IndexRange(range.begin() + size * node_offsets_[k] / total_threads,
+                          range.begin() + size * node_offsets_[k + 1] / total_threads);
+    };
+
+    static bool &isInNodeArena()
+    {
+        static thread_local bool is_in_node_arena = false;
+        return is_in_node_arena;
+    };
+} static &numa_partitioner = NumaPartitioner::getInstance();
+
+/**
+ * Parallel loop over a particle range with the partitioning of particle_for with ParallelPolicy.
+ */
+template <class LocalFunction>
+inline void partitioned_parallel_for(const IndexRange &range, const LocalFunction &local_function)
+{
+    if (numa_partitioner.isActive())
+    {
+        numa_partitioner.parallel_for(range, local_function);
+    }
+    else
+    {
+        tbb::parallel_for(range, local_function, ap);
+    }
+};
+
+/**
+ * Loop for the initialization of particle data.
+ * With active NUMA partitioning, it runs in parallel with the partitioning of particle_for,
+ * so that the pages are first touched by the node working on them later.
+ * Otherwise, it runs sequentially as before and the local function need not be thread safe.
+ */
+template <class LocalFunction>
+inline void first_touch_for(const IndexRange &range, const LocalFunction &local_function)
+{
+    if (numa_partitioner.isActive())
+    {
+        numa_partitioner.parallel_for(range, local_function);
+    }
+    else
+    {
+        local_function(range);
+    }
+};
+} // namespace SPH
+#endif // NUMA_PARTITIONER_H
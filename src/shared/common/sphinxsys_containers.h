@@ -61,6 +61,7 @@ class Wall;            /**< Interaction with wall boundary */
 class Extended;        /**< An extened method of an interaction type */
 class SpatialTemporal; /**< A interaction considering spatial temporal correlations */
 class Dynamic;         /**< A dynamic interaction */
+class HalfList;        /**< An inner neighbor list keeping each pair only once */
 
 using MaterialVector = StdVec<BaseMaterial *>;
 using SPHBodyVector = StdVec<SPHBody *>;
@@ -86,6 +87,8 @@ typedef DataContainerAssemble<AllocatedData> ParticleData;
 typedef DataContainerAddressAssemble<DiscreteVariable> ParticleVariables;
 /** Generalized particle variable type*/
 typedef DataContainerAddressAssemble<SingularVariable> SingularVariables;
+/** Generalized output-only particle variable type*/
+typedef DataContainerAddressAssemble<DerivedOutputVariable> DerivedOutputVariables;
 
 /** Generalized mesh data type */
 // template <typename DataType>
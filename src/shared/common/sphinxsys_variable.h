@@ -73,15 +73,29 @@ class SingularVariable : public Entity
 
   public:
     SingularVariable(const std::string &name, const DataType &value)
-        : Entity(name), value_(new DataType(value)), delegated_(value_){};
+        : Entity(name), value_(new DataType(value)), delegated_(value_), device_synchronizer_(nullptr){};
     ~SingularVariable() { delete value_; };
 
+    /** Direct access, which does not wait for the device work submitted asynchronously. */
     DataType *ValueAddress() { return delegated_; };
 
-    void setValue(const DataType &value) { *delegated_ = value; };
-    DataType getValue() { return *delegated_; };
+    /** The host access below waits for the device work which may still use a device-shared value. */
+    void setValue(const DataType &value)
+    {
+        synchronizeWithDevice();
+        *delegated_ = value;
+    };
+    DataType getValue()
+    {
+        synchronizeWithDevice();
+        return *delegated_;
+    };
 
-    void incrementValue(const DataType &value) { *delegated_ += value; };
+    void incrementValue(const DataType &value)
+    {
+        synchronizeWithDevice();
+        *delegated_ += value;
+    };
 
     template <class ExecutionPolicy>
     DataType *DelegatedData(const ExecutionPolicy &ex_policy) { return delegated_; };
@@ -97,10 +111,18 @@ class SingularVariable : public Entity
     };
     bool isValueDelegated() { return value_ != delegated_; };
     void setDelegateValueAddress(DataType *new_delegated) { delegated_ = new_delegated; };
+    void setDeviceSynchronizer(void (*device_synchronizer)()) { device_synchronizer_ = device_synchronizer; };
 
   protected:
     DataType *value_;
     DataType *delegated_;
+    void (*device_synchronizer_)(); /**< waits for the submitted device work, only set for a device-shared value */
+
+    void synchronizeWithDevice()
+    {
+        if (device_synchronizer_ != nullptr)
+            device_synchronizer_();
+    };
 };
 
 template <typename DataType>
@@ -134,6 +156,7 @@ class DiscreteVariable : public Entity
     template <class ExecutionPolicy>
     DataType *DelegatedDataField(const ExecutionPolicy &ex_policy) { return data_field_; };
     DataType *DelegatedDataField(const ParallelDevicePolicy &par_device);
+    DataType *DelegatedDataField(const TileStagedPolicy &tile_staged);
 
     bool existDeviceDataField() { return device_data_field_ != nullptr; };
     size_t getDataFieldSize() { return data_size_; }
@@ -156,6 +179,21 @@ class DiscreteVariable : public Entity
     template <class ExecutionPolicy>
     void prepareForOutput(const ExecutionPolicy &ex_policy){};
     void prepareForOutput(const ParallelDevicePolicy &ex_policy) { synchronizeWithDevice(); };
+    /** update the device data after the host data are read from files */
+    template <class ExecutionPolicy>
+    void synchronizeAfterInput(const ExecutionPolicy &ex_policy){};
+    void synchronizeAfterInput(const ParallelDevicePolicy &ex_policy) { synchronizeToDevice(); };
+    /** only record the device-to-host copy, which is done together with others by copyStagedOutputFromDevice */
+    template <class ExecutionPolicy>
+    void stageForOutput(const ExecutionPolicy &ex_policy){};
+    void stageForOutput(const ParallelDevicePolicy &ex_policy);
+    /** write the data of the first particles in binary, from device staged as by stageForOutput */
+    template <class ExecutionPolicy>
+    void writeToBinary(const ExecutionPolicy &ex_policy, std::ostream &out_stream, size_t data_size)
+    {
+        out_stream.write(reinterpret_cast<const char *>(data_field_), sizeof(DataType) * data_size);
+    };
+    void writeToBinary(const ParallelDevicePolicy &ex_policy, std::ostream &out_stream, size_t data_size);
 
   private:
     size_t data_size_;
@@ -171,6 +209,44 @@ class DiscreteVariable : public Entity
     };
 };
 
+/** complete the device-to-host copies and writes recorded by DiscreteVariable::stageForOutput and writeToBinary */
+template <class ExecutionPolicy>
+inline void copyStagedOutputFromDevice(const ExecutionPolicy &ex_policy){};
+#if SPHINXSYS_USE_SYCL
+inline void copyStagedOutputFromDevice(const ParallelDevicePolicy &ex_policy); // defined in sphinxsys_variable_sycl.hpp
+#endif // SPHINXSYS_USE_SYCL
+
+/**
+ * @class DerivedOutputVariable
+ * @brief An output-only particle variable without storage in particles.
+ * Its values are evaluated particle by particle only when the particles are written.
+ * The particle variables it is derived from are added as source variables,
+ * so that they are copied from device together with the variables to write.
+ */
+template <typename DataType>
+class DerivedOutputVariable : public Entity
+{
+  public:
+    using ValueType = DataType;
+    explicit DerivedOutputVariable(const std::string &name) : Entity(name){};
+    virtual ~DerivedOutputVariable(){};
+    DataContainerAddressAssemble<DiscreteVariable> &SourceVariables() { return source_variables_; };
+    /** called before each write, after the source variables are on host, to fetch their data fields */
+    virtual void setupOutput(){};
+    virtual DataType evaluate(size_t index_i) = 0;
+
+  protected:
+    DataContainerAddressAssemble<DiscreteVariable> source_variables_;
+
+    template <typename SourceType>
+    DiscreteVariable<SourceType> *addSourceVariable(DiscreteVariable<SourceType> *variable)
+    {
+        constexpr int type_index = DataTypeIndex<SourceType>::value;
+        std::get<type_index>(source_variables_).push_back(variable);
+        return variable;
+    };
+};
+
 template <typename DataType>
 class MeshVariable : public Entity
 {
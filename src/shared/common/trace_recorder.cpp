@@ -0,0 +1,112 @@
+#include "trace_recorder.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace SPH
+{
+//=================================================================================================//
+void TraceRingBuffer::push(size_t name_index, double begin, double duration)
+{
+    size_t head = head_.load(std::memory_order_relaxed);
+    TraceEvent &event = events_[head % events_.size()];
+    event.name_index_ = name_index;
+    event.begin_ = begin;
+    event.duration_ = duration;
+    head_.store(head + 1, std::memory_order_release);
+}
+//=================================================================================================//
+const TraceEvent &TraceRingBuffer::Event(size_t i)
+{
+    size_t head = head_.load(std::memory_order_acquire);
+    size_t oldest = head > events_.size() ? head - events_.size() : 0;
+    return events_[(oldest + i) % events_.size()];
+}
+//=================================================================================================//
+size_t TraceRecorder::addName(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(name_mutex_);
+    auto found = name_indices_.find(name);
+    if (found != name_indices_.end())
+        return found->second;
+    names_.push_back(name);
+    name_indices_.emplace(name, names_.size() - 1);
+    return names_.size() - 1;
+}
+//=================================================================================================//
+size_t TraceRecorder::internName(const std::string &name)
+{
+    static thread_local std::unordered_map<std::string, size_t> thread_name_indices;
+    auto found = thread_name_indices.find(name);
+    if (found != thread_name_indices.end())
+        return found->second;
+    size_t name_index = addName(name);
+    thread_name_indices.emplace(name, name_index);
+    return name_index;
+}
+//=================================================================================================//
+size_t TraceRecorder::internName(const char *name)
+{
+    static thread_local std::unordered_map<const char *, size_t> thread_name_indices;
+    auto found = thread_name_indices.find(name);
+    if (found != thread_name_indices.end())
+        return found->second;
+    size_t name_index = addName(std::string(name));
+    thread_name_indices.emplace(name, name_index);
+    return name_index;
+}
+//=================================================================================================//
+std::string TraceRecorder::Name(size_t name_index)
+{
+    std::lock_guard<std::mutex> lock(name_mutex_);
+    return names_[name_index];
+}
+//=================================================================================================//
+TraceRingBuffer &TraceRecorder::getThreadBuffer()
+{
+    static thread_local TraceRingBuffer *thread_buffer = nullptr;
+    if (thread_buffer == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(registration_mutex_);
+        thread_buffers_.push_back(
+            std::make_unique<TraceRingBuffer>(thread_buffers_.size(), buffer_capacity_));
+        thread_buffer = thread_buffers_.back().get();
+    }
+    return *thread_buffer;
+}
+//=================================================================================================//
+void TraceRecorder::writeTraceFile()
+{
+    std::lock_guard<std::mutex> lock(registration_mutex_);
+    if (thread_buffers_.empty())
+        return;
+
+    std::string filefullpath = output_folder_ + "/sphinxsys_trace.json";
+    std::ofstream out_file(filefullpath, std::ios::trunc);
+    out_file << std::fixed << std::setprecision(3);
+    out_file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool is_first_event = true;
+    for (auto &thread_buffer : thread_buffers_)
+    {
+        for (size_t i = 0; i != thread_buffer->Size(); ++i)
+        {
+            const TraceEvent &event = thread_buffer->Event(i);
+            out_file << (is_first_event ? "" : ",\n");
+            is_first_event = false;
+            out_file << "{\"name\": \"";
+            for (const char c : Name(event.name_index_))
+            {
+                if (c == '"' || c == '\\')
+                    out_file << '\\';
+                out_file << c;
+            }
+            out_file << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << thread_buffer->ThreadIndex()
+                     << ", \"ts\": " << event.begin_ << ", \"dur\": " << event.duration_ << "}";
+        }
+    }
+    out_file << "\n]}\n";
+    std::cout << "\n Trace of " << thread_buffers_.size() << " threads written to " << filefullpath << "\n";
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,162 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	trace_recorder.h
+ * @brief 	Optional timeline tracing exported as Chrome trace-event JSON,
+ *          which can be loaded into chrome://tracing or the Perfetto UI.
+ * @details Each thread writes complete events into its own ring buffer,
+ *          so that recording is lock-free. When a buffer is full, the oldest
+ *          events are overwritten. Event names are interned into a name table
+ *          so that an event only stores the index of its name. The trace file
+ *          is written by writeTraceFile, which is called at the end of a run
+ *          when the SPH system is destroyed.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include "large_data_containers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace SPH
+{
+struct TraceEvent
+{
+    size_t name_index_; /**< index in the name table of the recorder */
+    double begin_;    /**< in microseconds since the start of the trace */
+    double duration_; /**< in microseconds */
+};
+
+class TraceRingBuffer
+{
+  public:
+    TraceRingBuffer(size_t thread_index, size_t capacity)
+        : thread_index_(thread_index), events_(capacity), head_(0){};
+    /** Only called by the owning thread. */
+    void push(size_t name_index, double begin, double duration);
+    size_t ThreadIndex() { return thread_index_; };
+    size_t Size() { return std::min(head_.load(std::memory_order_acquire), events_.size()); };
+    /** The i-th event starting from the oldest one still in the buffer. */
+    const TraceEvent &Event(size_t i);
+
+  protected:
+    size_t thread_index_;
+    std::vector<TraceEvent> events_;
+    std::atomic<size_t> head_;
+};
+
+class TraceRecorder
+{
+  public:
+    TraceRecorder(TraceRecorder const &) = delete;
+    void operator=(TraceRecorder const &) = delete;
+
+    static TraceRecorder &getInstance()
+    {
+        static TraceRecorder instance;
+        return instance;
+    }
+
+    bool isActive() { return is_active_; };
+    void setActive(bool is_active) { is_active_ = is_active; };
+    void setOutputFolder(const std::string &output_folder) { output_folder_ = output_folder; };
+    /** Capacity of the ring buffers created afterwards, in number of events per thread. */
+    void setBufferCapacity(size_t buffer_capacity) { buffer_capacity_ = buffer_capacity; };
+    double now() { return (TickCount::now() - start_).seconds() * 1.0e6; };
+    /** Index of the name in the name table, only locked when the calling thread meets a new name. */
+    size_t internName(const std::string &name);
+    /** As above, but looked up by the address of a name which should outlive the recorder, e.g. a string literal. */
+    size_t internName(const char *name);
+    std::string Name(size_t name_index);
+    void record(size_t name_index, double begin, double duration)
+    {
+        getThreadBuffer().push(name_index, begin, duration);
+    };
+    /** Writes all events recorded so far, overwriting a previously written trace file. */
+    void writeTraceFile();
+
+  protected:
+    TraceRecorder()
+        : is_active_(false), output_folder_("."),
+          buffer_capacity_(1 << 16), start_(TickCount::now()){};
+    TraceRingBuffer &getThreadBuffer();
+    size_t addName(const std::string &name);
+
+    bool is_active_;
+    std::string output_folder_;
+    size_t buffer_capacity_;
+    TickCount start_;
+    std::mutex registration_mutex_;
+    StdVec<std::unique_ptr<TraceRingBuffer>> thread_buffers_;
+    std::mutex name_mutex_;
+    std::unordered_map<std::string, size_t> name_indices_;
+    StdVec<std::string> names_;
+} static &trace_recorder = TraceRecorder::getInstance();
+
+/**
+ * @class TraceScope
+ * @brief Records a complete event from construction to destruction
+ * if tracing is active at construction.
+ */
+class TraceScope
+{
+  public:
+    /** The name should outlive the recorder, e.g. a string literal. */
+    explicit TraceScope(const char *name)
+        : is_traced_(trace_recorder.isActive())
+    {
+        if (is_traced_)
+        {
+            name_index_ = trace_recorder.internName(name);
+            begin_ = trace_recorder.now();
+        }
+    };
+    explicit TraceScope(const std::string &name)
+        : is_traced_(trace_recorder.isActive())
+    {
+        if (is_traced_)
+        {
+            name_index_ = trace_recorder.internName(name);
+            begin_ = trace_recorder.now();
+        }
+    };
+    ~TraceScope()
+    {
+        if (is_traced_)
+            trace_recorder.record(name_index_, begin_, trace_recorder.now() - begin_);
+    };
+
+  protected:
+    bool is_traced_;
+    size_t name_index_ = 0;
+    double begin_ = 0.0;
+};
+} // namespace SPH
+#endif // TRACE_RECORDER_H
@@ -28,6 +28,7 @@ io class used in SPHinXsys. **/
 #define IO_ALL_H
 
 #include "io_base.h"
+#include "io_output_filter.h"
 #include "io_observation.h"
 #include "io_plt.h"
 #include "io_simbody.h"
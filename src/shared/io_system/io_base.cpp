@@ -43,6 +43,7 @@ BodyStatesRecording::BodyStatesRecording(SPHBody &body)
 //=============================================================================================//
 void BodyStatesRecording::writeToFile()
 {
+    TraceScope trace_scope("BodyStatesRecording::writeToFile");
     for (auto &derived_variable : derived_variables_)
     {
         derived_variable->exec();
@@ -52,6 +53,7 @@ void BodyStatesRecording::writeToFile()
 //=============================================================================================//
 void BodyStatesRecording::writeToFile(size_t iteration_step)
 {
+    TraceScope trace_scope("BodyStatesRecording::writeToFile");
     for (auto &derived_variable : derived_variables_)
     {
         derived_variable->exec();
@@ -59,6 +61,48 @@ void BodyStatesRecording::writeToFile(size_t iteration_step)
     writeWithFileName(padValueWithZeros(iteration_step));
 };
 //=============================================================================================//
+OutputParticles BodyStatesRecording::selectOutputParticles(SPHBody *body)
+{
+    size_t total_real_particles = body->getBaseParticles().TotalRealParticles();
+    size_t body_index = std::find(bodies_.begin(), bodies_.end(), body) - bodies_.begin();
+    if (body_index >= output_filters_.size() || output_filters_[body_index].empty())
+    {
+        return OutputParticles(total_real_particles);
+    }
+
+    StdVec<BaseOutputFilter *> &filters = output_filters_[body_index];
+    for (auto &filter : filters)
+    {
+        filter->setupFilter();
+    }
+    is_selected_.resize(total_real_particles + 1);
+    selected_offset_.resize(total_real_particles + 1);
+    UnsignedInt *is_selected = is_selected_.data();
+    UnsignedInt *selected_offset = selected_offset_.data();
+    particle_for(par, IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     bool selected = true;
+                     for (size_t k = 0; k != filters.size() && selected; ++k)
+                     {
+                         selected = filters[k]->isSelected(i);
+                     }
+                     is_selected[i] = selected ? 1 : 0;
+                 });
+    is_selected[total_real_particles] = 0;
+    UnsignedInt total_selected = exclusive_scan(par, is_selected, selected_offset,
+                                                total_real_particles + 1, std::plus<UnsignedInt>());
+    output_particles_.resize(total_selected);
+    size_t *output_particles = output_particles_.data();
+    particle_for(par, IndexRange(0, total_real_particles),
+                 [&](size_t i)
+                 {
+                     if (is_selected[i] != 0)
+                         output_particles[selected_offset[i]] = i;
+                 });
+    return OutputParticles(output_particles_);
+}
+//=============================================================================================//
 RestartIO::RestartIO(SPHSystem &sph_system)
     : BaseIO(sph_system), bodies_(sph_system.getRealBodies()),
       overall_file_path_(io_environment_.restart_folder_ + "/Restart_time_")
@@ -70,13 +114,13 @@ RestartIO::RestartIO(SPHSystem &sph_system)
         // basic variable for write to restart file
         BaseParticles &particles = bodies_[i]->getBaseParticles();
         particles.addVariableToRestart<UnsignedInt>("OriginalID");
-        prepare_variable_to_restart_.push_back(
-            OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>(
+        synchronize_variable_from_restart_.push_back(
+            OperationOnDataAssemble<ParticleVariables, synchronizeVariablesRead>(
                 particles.VariablesToRestart()));
     }
 }
 //=============================================================================================//
-void RestartIO::writeToFile(size_t iteration_step)
+void RestartIO::writeRestartTime(size_t iteration_step)
 {
     std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(iteration_step) + ".dat";
     if (fs::exists(overall_filefullpath))
@@ -86,17 +130,11 @@ void RestartIO::writeToFile(size_t iteration_step)
     std::ofstream out_file(overall_filefullpath.c_str(), std::ios::app);
     out_file << std::fixed << std::setprecision(9) << sv_physical_time_.getValue() << "   \n";
     out_file.close();
-
-    for (size_t i = 0; i < bodies_.size(); ++i)
-    {
-        std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) + ".xml";
-
-        if (fs::exists(filefullpath))
-        {
-            fs::remove(filefullpath);
-        }
-        bodies_[i]->writeParticlesToXmlForRestart(filefullpath);
-    }
+}
+//=============================================================================================//
+void RestartIO::writeToFile(size_t iteration_step)
+{
+    writeToFile(execution::seq, iteration_step);
 }
 //=============================================================================================//
 Real RestartIO::readRestartTime(size_t restart_step)
@@ -118,6 +156,55 @@ Real RestartIO::readRestartTime(size_t restart_step)
 }
 //=============================================================================================//
 void RestartIO::readFromFile(size_t restart_step)
+{
+    for (size_t i = 0; i < bodies_.size(); ++i)
+    {
+        std::string filefullpath = file_names_[i] + padValueWithZeros(restart_step) + ".bin";
+
+        if (!fs::exists(filefullpath))
+        {
+            std::cout << "\n Error: the input file:" << filefullpath << " is not exists" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        bodies_[i]->getBaseParticles().readParticlesFromBinaryForRestart(filefullpath);
+    }
+}
+//=============================================================================================//
+CheckpointIO::CheckpointIO(SPHSystem &sph_system) : RestartIO(sph_system)
+{
+    overall_file_path_ = io_environment_.restart_folder_ + "/Checkpoint_time_";
+    synchronize_variable_from_restart_.clear(); // all states are restored from a checkpoint
+    for (size_t i = 0; i < bodies_.size(); ++i)
+    {
+        file_names_[i] = io_environment_.restart_folder_ + "/" + bodies_[i]->getName() + "_ckp_";
+        prepare_variable_to_checkpoint_.push_back(
+            OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>(
+                bodies_[i]->getBaseParticles().AllDiscreteVariables()));
+        synchronize_variable_from_restart_.push_back(
+            OperationOnDataAssemble<ParticleVariables, synchronizeVariablesRead>(
+                bodies_[i]->getBaseParticles().AllDiscreteVariables()));
+    }
+}
+//=============================================================================================//
+void CheckpointIO::writeToFile(size_t iteration_step)
+{
+    writeRestartTime(iteration_step);
+
+    for (size_t i = 0; i < bodies_.size(); ++i)
+    {
+        std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) + ".xml";
+
+        if (fs::exists(filefullpath))
+        {
+            fs::remove(filefullpath);
+        }
+        bodies_[i]->getBaseParticles().writeParticlesToXmlForCheckpoint(filefullpath);
+    }
+}
+//=============================================================================================//
+void CheckpointIO::readFromFile(size_t restart_step)
 {
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
@@ -130,7 +217,7 @@ void RestartIO::readFromFile(size_t restart_step)
             exit(1);
         }
 
-        bodies_[i]->readParticlesFromXmlForRestart(filefullpath);
+        bodies_[i]->getBaseParticles().readParticlesFromXmlForCheckpoint(filefullpath);
     }
 }
 //=============================================================================================//
@@ -172,6 +259,70 @@ void ReloadParticleIO::writeToFile(size_t iteration_step)
     }
 }
 //=============================================================================================//
+ParticleRelaxationCache::ParticleRelaxationCache(SPHBody &sph_body, const StdVec<Real> &relaxation_parameters)
+    : ParticleRelaxationCache(cacheName(sph_body, relaxation_parameters), sph_body) {}
+//=============================================================================================//
+ParticleRelaxationCache::ParticleRelaxationCache(const std::string &reload_name, SPHBody &sph_body)
+    : ReloadParticleIO(sph_body, reload_name), reload_name_(reload_name),
+      is_cached_(fs::exists(file_names_[0]))
+{
+    fs::path cache_folder = fs::path(file_names_[0]).parent_path();
+    if (!fs::exists(cache_folder))
+    {
+        fs::create_directory(cache_folder);
+    }
+    std::cout << "\n Relaxation cache for " << sph_body.getName() << " is "
+              << (is_cached_ ? "found: " : "not found: ") << file_names_[0] << std::endl;
+}
+//=============================================================================================//
+std::string ParticleRelaxationCache::cacheName(SPHBody &sph_body, const StdVec<Real> &relaxation_parameters)
+{
+    // 64-bit FNV-1a hash
+    uint64_t hash = 14695981039346656037ull;
+    auto hash_bytes = [&](const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i != size; ++i)
+        {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+
+    Real spacing = sph_body.getSPHBodyResolutionRef();
+    BoundingBox system_bounds = sph_body.getSPHSystemBounds();
+    hash_bytes(&spacing, sizeof(Real));
+    hash_bytes(system_bounds.first_.data(), sizeof(Real) * Dimensions);
+    hash_bytes(system_bounds.second_.data(), sizeof(Real) * Dimensions);
+    hash_bytes(relaxation_parameters.data(), sizeof(Real) * relaxation_parameters.size());
+
+    // the shape is sampled on the same lattice as that used for generating particles
+    Shape &shape = sph_body.getInitialShape();
+    BoundingBox shape_bounds = shape.getBounds();
+    Mesh mesh(system_bounds, spacing, 0);
+    Arrayi lower = mesh.CellIndexFromPosition(shape_bounds.first_);
+    Arrayi upper = mesh.CellIndexFromPosition(shape_bounds.second_) + Arrayi::Ones();
+    hash_bytes(lower.data(), sizeof(int) * Dimensions);
+    hash_bytes(upper.data(), sizeof(int) * Dimensions);
+    mesh_for_each(
+        lower, upper,
+        [&](const Arrayi &cell_index)
+        {
+            Vecd position = mesh.CellPositionFromIndex(cell_index);
+            unsigned char is_contained = shape.checkNotFar(position, spacing) && shape.checkContain(position);
+            hash_bytes(&is_contained, 1);
+        });
+
+    std::stringstream hash_string;
+    hash_string << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return "relaxation_cache/" + sph_body.getName() + "_" + hash_string.str();
+}
+//=============================================================================================//
+void ParticleRelaxationCache::writeToFile(size_t iteration_step)
+{
+    ReloadParticleIO::writeToFile(iteration_step);
+    is_cached_ = true;
+}
+//=============================================================================================//
 ParticleGenerationRecording::ParticleGenerationRecording(SPHBody &sph_body)
     : BaseIO(sph_body.getSPHSystem()), sph_body_(sph_body),
       state_recording_(sph_system_.StateRecording()) {}
@@ -32,6 +32,7 @@
 #include "all_physical_dynamics.h"
 #include "base_body.h"
 #include "base_data_package.h"
+#include "io_output_filter.h"
 #include "parameterization.h"
 #include "sphinxsys_containers.h"
 #include "xml_engine.h"
@@ -39,6 +40,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <numeric>
 #include <sstream>
 namespace fs = std::filesystem;
 
@@ -86,7 +88,22 @@ class BaseIO
         {
             for (size_t i = 0; i != variables.size(); ++i)
             {
-                variables[i]->prepareForOutput(ex_policy);
+                variables[i]->stageForOutput(ex_policy);
+            }
+        };
+    };
+
+    struct synchronizeVariablesRead
+    {
+        synchronizeVariablesRead(){};
+
+        template <class ExecutionPolicy, typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        const ExecutionPolicy &ex_policy)
+        {
+            for (size_t i = 0; i != variables.size(); ++i)
+            {
+                variables[i]->synchronizeAfterInput(ex_policy);
             }
         };
     };
@@ -106,16 +123,21 @@ class BodyStatesRecording : public BaseIO
     /** write with filename indicated by physical time */
     void writeToFile();
 
+#if SPHINXSYS_USE_SYCL
     void writeToFile(const ParallelDevicePolicy &ex_policy)
     {
         for (size_t i = 0; i < bodies_.size(); ++i)
         {
-            dv_all_pos_[i]->prepareForOutput(ex_policy);
+            dv_all_pos_[i]->stageForOutput(ex_policy);
             prepare_variable_to_write_[i](ex_policy);
+            stageDerivedVariableSources(bodies_[i]->getBaseParticles(), ex_policy);
+            stageOutputFilterSources(i, ex_policy);
         }
+        copyStagedOutputFromDevice(ex_policy);
 
         writeToFile();
     };
+#endif // SPHINXSYS_USE_SYCL
 
     void writeToFile(const ParallelPolicy &ex_policy)
     {
@@ -145,6 +167,44 @@ class BodyStatesRecording : public BaseIO
         }
     };
 
+    /** The derived variable is evaluated only when a frame is written, without storage in particles. */
+    template <class DerivedOutputType, typename... Args>
+    void addDerivedVariableToWrite(SPHBody &sph_body, Args &&...args)
+    {
+        if (isBodyIncluded(bodies_, &sph_body))
+        {
+            sph_body.getBaseParticles().addDerivedVariableToWrite<DerivedOutputType>(
+                sph_body, std::forward<Args>(args)...);
+        }
+        else
+        {
+            std::cout << "\n Error: the body:" << sph_body.getName()
+                      << " is not in the recording list" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    };
+
+    /** Particles of a body are written only if they are selected by all its filters. */
+    template <class OutputFilterType, typename... Args>
+    void addOutputFilter(SPHBody &sph_body, Args &&...args)
+    {
+        auto body = std::find(bodies_.begin(), bodies_.end(), &sph_body);
+        if (body != bodies_.end())
+        {
+            output_filters_.resize(bodies_.size());
+            output_filters_[body - bodies_.begin()].push_back(
+                output_filters_keeper_.createPtr<OutputFilterType>(sph_body, std::forward<Args>(args)...));
+        }
+        else
+        {
+            std::cout << "\n Error: the body:" << sph_body.getName()
+                      << " is not in the recording list" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    };
+
     template <typename DerivedVariableMethod,
               typename DynamicsIdentifier, typename... Args>
     void addDerivedVariableRecording(DynamicsIdentifier &identifier, Args &&...args)
@@ -172,16 +232,53 @@ class BodyStatesRecording : public BaseIO
     bool state_recording_;
     StdVec<OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>>
         prepare_variable_to_write_;
+    StdVec<StdVec<BaseOutputFilter *>> output_filters_;
+    StdVec<UnsignedInt> is_selected_;
+    StdVec<UnsignedInt> selected_offset_;
+    IndexVector output_particles_;
 
     virtual void writeWithFileName(const std::string &sequence) = 0;
+    /** the derived variables are evaluated on host from their source variables */
+    template <class ExecutionPolicy>
+    void stageDerivedVariableSources(BaseParticles &particles, const ExecutionPolicy &ex_policy)
+    {
+        DerivedOutputVariables &derived_variables_to_write = particles.DerivedVariablesToWrite();
+        constexpr int type_index_Real = DataTypeIndex<Real>::value;
+        for (DerivedOutputVariable<Real> *variable : std::get<type_index_Real>(derived_variables_to_write))
+        {
+            OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>(variable->SourceVariables())(ex_policy);
+        }
+        constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+        for (DerivedOutputVariable<Vecd> *variable : std::get<type_index_Vecd>(derived_variables_to_write))
+        {
+            OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>(variable->SourceVariables())(ex_policy);
+        }
+    };
+    /** the output filters select the particles on host from their source variables */
+    template <class ExecutionPolicy>
+    void stageOutputFilterSources(size_t body_index, const ExecutionPolicy &ex_policy)
+    {
+        if (body_index < output_filters_.size())
+        {
+            for (BaseOutputFilter *filter : output_filters_[body_index])
+            {
+                OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>(filter->SourceVariables())(ex_policy);
+            }
+        }
+    };
+    /** select the particles of a body to be written by its filters in parallel */
+    OutputParticles selectOutputParticles(SPHBody *body);
 
   private:
     UniquePtrsKeeper<BaseDynamics<void>> derived_variables_keeper_;
+    UniquePtrsKeeper<BaseOutputFilter> output_filters_keeper_;
 };
 
 /**
  * @class RestartIO
- * @brief Write and read the restart files in XML format.
+ * @brief Write and read the restart files in binary format.
+ * With the device execution policy, the restart variables of all bodies are copied
+ * from device together into a pinned host buffer and written from there to the files.
  */
 class RestartIO : public BaseIO
 {
@@ -189,9 +286,10 @@ class RestartIO : public BaseIO
     SPHBodyVector bodies_;
     std::string overall_file_path_;
     StdVec<std::string> file_names_;
-    StdVec<OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>>
-        prepare_variable_to_restart_;
+    StdVec<OperationOnDataAssemble<ParticleVariables, synchronizeVariablesRead>>
+        synchronize_variable_from_restart_;
 
+    void writeRestartTime(size_t iteration_step);
     Real readRestartTime(size_t restart_step);
 
   public:
@@ -203,11 +301,17 @@ class RestartIO : public BaseIO
     template <class ExecutionPolicy>
     void writeToFile(const ExecutionPolicy &ex_policy, size_t iteration_step = 0)
     {
+        writeRestartTime(iteration_step);
+
+        // the files are kept open until the writes staged from device are done
+        StdVec<std::ofstream> out_files(bodies_.size());
         for (size_t i = 0; i < bodies_.size(); ++i)
         {
-            prepare_variable_to_restart_[i](ex_policy);
+            std::string filefullpath = file_names_[i] + padValueWithZeros(iteration_step) + ".bin";
+            out_files[i].open(filefullpath, std::ios::out | std::ios::binary | std::ios::trunc);
+            bodies_[i]->getBaseParticles().writeParticlesToBinaryForRestart(ex_policy, out_files[i]);
         }
-        writeToFile(iteration_step);
+        copyStagedOutputFromDevice(ex_policy);
     };
 
     virtual void readFromFile(size_t iteration_step = 0);
@@ -217,6 +321,56 @@ class RestartIO : public BaseIO
         readFromFile(restart_step);
         return readRestartTime(restart_step);
     };
+
+    /** restore the states and update their device data, which are allocated already */
+    template <class ExecutionPolicy>
+    Real readRestartFiles(const ExecutionPolicy &ex_policy, size_t restart_step)
+    {
+        Real restart_time = readRestartFiles(restart_step);
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            synchronize_variable_from_restart_[i](ex_policy);
+        }
+        return restart_time;
+    };
+};
+
+/**
+ * @class CheckpointIO
+ * @brief Write and read the full-state checkpoint files in XML format.
+ * Besides all particle states, the files record the particle bounds and the sorted order,
+ * so that the bodies can be generated directly from a checkpoint by
+ * generateParticles<BaseParticles, Checkpoint>(checkpoint_step)
+ * without particle generation and relaxation.
+ * The other states are restored by readRestartFiles, which should be called
+ * after all particle dynamics are constructed but before any is executed,
+ * with the execution policy of the dynamics so that their device data are also updated.
+ * Cell linked lists and relations are then rebuilt from the restored positions.
+ */
+class CheckpointIO : public RestartIO
+{
+  protected:
+    StdVec<OperationOnDataAssemble<ParticleVariables, prepareVariablesToWrite>>
+        prepare_variable_to_checkpoint_;
+
+  public:
+    CheckpointIO(SPHSystem &sph_system);
+    virtual ~CheckpointIO(){};
+
+    virtual void writeToFile(size_t iteration_step = 0) override;
+
+    template <class ExecutionPolicy>
+    void writeToFile(const ExecutionPolicy &ex_policy, size_t iteration_step = 0)
+    {
+        for (size_t i = 0; i < bodies_.size(); ++i)
+        {
+            prepare_variable_to_checkpoint_[i](ex_policy);
+        }
+        copyStagedOutputFromDevice(ex_policy);
+        writeToFile(iteration_step);
+    };
+
+    virtual void readFromFile(size_t iteration_step = 0) override;
 };
 
 /**
@@ -262,10 +416,36 @@ class ReloadParticleIO : public BaseIO
         {
             prepare_variable_to_reload_[i](ex_policy);
         }
+        copyStagedOutputFromDevice(ex_policy);
         writeToFile(iteration_step);
     };
 };
 
+/**
+ * @class ParticleRelaxationCache
+ * @brief Cache of relaxed particles in the reload folder.
+ * The cache file is named by a hash of the body shape sampled on the generating lattice,
+ * the reference resolution, the system bounds and the given relaxation parameters.
+ * When the cache is available, the particles are generated by
+ * generateParticles<BaseParticles, Reload>(cache.ReloadName()) and the relaxation can be skipped.
+ * Otherwise, the particles are relaxed as usual and written by writeToFile().
+ */
+class ParticleRelaxationCache : public ReloadParticleIO
+{
+  public:
+    ParticleRelaxationCache(SPHBody &sph_body, const StdVec<Real> &relaxation_parameters = {});
+    virtual ~ParticleRelaxationCache(){};
+    std::string ReloadName() { return reload_name_; };
+    bool isCached() { return is_cached_; };
+    virtual void writeToFile(size_t iteration_step = 0) override;
+
+  protected:
+    std::string reload_name_;
+    bool is_cached_;
+    ParticleRelaxationCache(const std::string &reload_name, SPHBody &sph_body);
+    static std::string cacheName(SPHBody &sph_body, const StdVec<Real> &relaxation_parameters);
+};
+
 class ParticleGenerationRecording : public BaseIO
 {
 
@@ -50,6 +50,7 @@ class ObservedQuantityRecording<VariableType> : public BodyStatesRecording,
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    QuantityRecordingBuffer recording_buffer_;
 
   public:
     VariableType type_indicator_; /*< this is an indicator to identify the variable type. */
@@ -61,10 +62,11 @@ class ObservedQuantityRecording<VariableType> : public BodyStatesRecording,
           observer_(contact_relation.getSPHBody()), plt_engine_(),
           base_particles_(observer_.getBaseParticles()),
           dynamics_identifier_name_(contact_relation.getSPHBody().getName()),
-          quantity_name_(quantity_name)
+          quantity_name_(quantity_name),
+          filefullpath_output_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat"),
+          recording_buffer_(filefullpath_output_)
     {
         /** Output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat";
         std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
         out_file << "run_time"
                  << "   ";
@@ -81,16 +83,19 @@ class ObservedQuantityRecording<VariableType> : public BodyStatesRecording,
     virtual void writeWithFileName(const std::string &sequence) override
     {
         this->exec();
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
+        recording_buffer_.startRow(sv_physical_time_.getValue());
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
-            plt_engine_.writeAQuantity(out_file, this->interpolated_quantities_[i]);
+            recording_buffer_.appendQuantity(this->interpolated_quantities_[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        recording_buffer_.closeRow();
     };
 
+    /** the rows are appended to the .dat file every flush_interval records
+     *  or flush_time_interval seconds, whichever comes first */
+    void setFlushInterval(size_t flush_interval) { recording_buffer_.setFlushInterval(flush_interval); };
+    void setFlushTimeInterval(Real flush_time_interval) { recording_buffer_.setFlushTimeInterval(flush_time_interval); };
+
     VariableType *getObservedQuantity()
     {
         return this->interpolated_quantities_;
@@ -112,6 +117,7 @@ class ReducedQuantityRecording<LocalReduceMethodType> : public BaseIO
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    QuantityRecordingBuffer recording_buffer_;
 
   public:
     /*< deduce variable type from reduce method. */
@@ -124,10 +130,11 @@ class ReducedQuantityRecording<LocalReduceMethodType> : public BaseIO
         : BaseIO(identifier.getSPHBody().getSPHSystem()), plt_engine_(),
           reduce_method_(identifier, std::forward<Args>(args)...),
           dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
-          quantity_name_(reduce_method_.QuantityName())
+          quantity_name_(reduce_method_.QuantityName()),
+          filefullpath_output_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat"),
+          recording_buffer_(filefullpath_output_)
     {
         /** output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat";
         std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
         out_file << "\"run_time\""
                  << "   ";
@@ -139,12 +146,15 @@ class ReducedQuantityRecording<LocalReduceMethodType> : public BaseIO
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
-        plt_engine_.writeAQuantity(out_file, reduce_method_.exec());
-        out_file << "\n";
-        out_file.close();
+        recording_buffer_.startRow(sv_physical_time_.getValue());
+        recording_buffer_.appendQuantity(reduce_method_.exec());
+        recording_buffer_.closeRow();
     };
+
+    /** the rows are appended to the .dat file every flush_interval records
+     *  or flush_time_interval seconds, whichever comes first */
+    void setFlushInterval(size_t flush_interval) { recording_buffer_.setFlushInterval(flush_interval); };
+    void setFlushTimeInterval(Real flush_time_interval) { recording_buffer_.setFlushTimeInterval(flush_time_interval); };
 };
 } // namespace SPH
 #endif // IO_OBSERVATION_H
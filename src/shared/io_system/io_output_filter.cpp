@@ -0,0 +1,71 @@
+#include "io_output_filter.h"
+
+namespace SPH
+{
+//=============================================================================================//
+OutputFilterInBox::OutputFilterInBox(SPHBody &sph_body, const BoundingBox &bounding_box)
+    : BaseOutputFilter(sph_body), bounding_box_(bounding_box), pos_(nullptr) {}
+//=============================================================================================//
+void OutputFilterInBox::setupFilter()
+{
+    pos_ = particles_->ParticlePositions();
+}
+//=============================================================================================//
+bool OutputFilterInBox::isSelected(size_t index_i)
+{
+    return bounding_box_.checkContain(pos_[index_i]);
+}
+//=============================================================================================//
+OutputFilterInShape::OutputFilterInShape(SPHBody &sph_body, Shape &shape)
+    : BaseOutputFilter(sph_body), shape_(shape), pos_(nullptr) {}
+//=============================================================================================//
+void OutputFilterInShape::setupFilter()
+{
+    pos_ = particles_->ParticlePositions();
+}
+//=============================================================================================//
+bool OutputFilterInShape::isSelected(size_t index_i)
+{
+    return shape_.checkContain(pos_[index_i]);
+}
+//=============================================================================================//
+OutputFilterStride::OutputFilterStride(SPHBody &sph_body, UnsignedInt stride)
+    : BaseOutputFilter(sph_body), stride_(SMAX(stride, UnsignedInt(1))), original_id_(nullptr)
+{
+    addSourceVariable(particles_->getVariableByName<UnsignedInt>("OriginalID"));
+}
+//=============================================================================================//
+void OutputFilterStride::setupFilter()
+{
+    original_id_ = particles_->ParticleOriginalIds();
+}
+//=============================================================================================//
+bool OutputFilterStride::isSelected(size_t index_i)
+{
+    return original_id_[index_i] % stride_ == 0;
+}
+//=============================================================================================//
+OutputFilterRandom::OutputFilterRandom(SPHBody &sph_body, Real fraction, UnsignedInt seed)
+    : BaseOutputFilter(sph_body),
+      threshold_(uint64_t(SMIN(SMAX(fraction, Real(0)), Real(1)) * Real(uint64_t(1) << 32))),
+      seed_(seed), original_id_(nullptr)
+{
+    addSourceVariable(particles_->getVariableByName<UnsignedInt>("OriginalID"));
+}
+//=============================================================================================//
+void OutputFilterRandom::setupFilter()
+{
+    original_id_ = particles_->ParticleOriginalIds();
+}
+//=============================================================================================//
+bool OutputFilterRandom::isSelected(size_t index_i)
+{
+    // splitmix64 finalizer of the original ID, kept to its upper 32 bits
+    uint64_t hash = uint64_t(original_id_[index_i]) + seed_ * 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash = hash ^ (hash >> 31);
+    return (hash >> 32) < threshold_;
+}
+//=============================================================================================//
+} // namespace SPH
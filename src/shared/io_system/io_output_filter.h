@@ -0,0 +1,204 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_output_filter.h
+ * @brief 	Filters to select the particles written by body states recordings,
+ *          such as a region of interest, a decimation or a predicate on a variable.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_OUTPUT_FILTER_H
+#define IO_OUTPUT_FILTER_H
+
+#include "base_body.h"
+#include "base_geometry.h"
+#include "base_particles.hpp"
+
+namespace SPH
+{
+/**
+ * @class BaseOutputFilter
+ * @brief Selects particles for output. The filters of a body are combined,
+ * i.e. a particle is written only if all filters select it.
+ * The particle variables a filter selects by are added as source variables,
+ * so that they are copied from device before the selection.
+ * The positions are not added, as they are always copied for output.
+ */
+class BaseOutputFilter
+{
+  public:
+    explicit BaseOutputFilter(SPHBody &sph_body)
+        : particles_(&sph_body.getBaseParticles()){};
+    virtual ~BaseOutputFilter(){};
+    DataContainerAddressAssemble<DiscreteVariable> &SourceVariables() { return source_variables_; };
+    /** called before each selection, e.g. to fetch data fields which may have been reallocated */
+    virtual void setupFilter(){};
+    virtual bool isSelected(size_t index_i) = 0;
+
+  protected:
+    BaseParticles *particles_;
+    DataContainerAddressAssemble<DiscreteVariable> source_variables_;
+
+    template <typename SourceType>
+    DiscreteVariable<SourceType> *addSourceVariable(DiscreteVariable<SourceType> *variable)
+    {
+        constexpr int type_index = DataTypeIndex<SourceType>::value;
+        std::get<type_index>(source_variables_).push_back(variable);
+        return variable;
+    };
+};
+
+/**
+ * @class OutputParticles
+ * @brief The particles to write, either all real particles as an index range
+ * or the indices of the particles selected by the output filters.
+ */
+class OutputParticles
+{
+  public:
+    explicit OutputParticles(size_t total_real_particles)
+        : selected_(nullptr), size_(total_real_particles){};
+    explicit OutputParticles(const IndexVector &selected)
+        : selected_(selected.data()), size_(selected.size()){};
+
+    class Iterator
+    {
+      public:
+        Iterator(const size_t *selected, size_t position) : selected_(selected), position_(position){};
+        size_t operator*() const { return selected_ == nullptr ? position_ : selected_[position_]; };
+        Iterator &operator++()
+        {
+            ++position_;
+            return *this;
+        };
+        bool operator!=(const Iterator &other) const { return position_ != other.position_; };
+
+      protected:
+        const size_t *selected_;
+        size_t position_;
+    };
+
+    Iterator begin() const { return Iterator(selected_, 0); };
+    Iterator end() const { return Iterator(selected_, size_); };
+    size_t size() const { return size_; };
+
+  protected:
+    const size_t *selected_;
+    size_t size_;
+};
+
+/**
+ * @class OutputFilterInBox
+ * @brief Selects the particles within a bounding box.
+ */
+class OutputFilterInBox : public BaseOutputFilter
+{
+  public:
+    OutputFilterInBox(SPHBody &sph_body, const BoundingBox &bounding_box);
+    virtual ~OutputFilterInBox(){};
+    virtual void setupFilter() override;
+    virtual bool isSelected(size_t index_i) override;
+
+  protected:
+    BoundingBox bounding_box_;
+    Vecd *pos_;
+};
+
+/**
+ * @class OutputFilterInShape
+ * @brief Selects the particles within a shape, e.g. a level-set shape.
+ */
+class OutputFilterInShape : public BaseOutputFilter
+{
+  public:
+    OutputFilterInShape(SPHBody &sph_body, Shape &shape);
+    virtual ~OutputFilterInShape(){};
+    virtual void setupFilter() override;
+    virtual bool isSelected(size_t index_i) override;
+
+  protected:
+    Shape &shape_;
+    Vecd *pos_;
+};
+
+/**
+ * @class OutputFilterStride
+ * @brief Selects every stride-th particle by original particle ID,
+ * so that the same particles are written in all frames even after particle sorting.
+ */
+class OutputFilterStride : public BaseOutputFilter
+{
+  public:
+    OutputFilterStride(SPHBody &sph_body, UnsignedInt stride);
+    virtual ~OutputFilterStride(){};
+    virtual void setupFilter() override;
+    virtual bool isSelected(size_t index_i) override;
+
+  protected:
+    UnsignedInt stride_;
+    UnsignedInt *original_id_;
+};
+
+/**
+ * @class OutputFilterRandom
+ * @brief Selects a random fraction of the particles by hashing the original particle IDs,
+ * so that the selection is reproducible and the same in all frames.
+ */
+class OutputFilterRandom : public BaseOutputFilter
+{
+  public:
+    OutputFilterRandom(SPHBody &sph_body, Real fraction, UnsignedInt seed = 0);
+    virtual ~OutputFilterRandom(){};
+    virtual void setupFilter() override;
+    virtual bool isSelected(size_t index_i) override;
+
+  protected:
+    uint64_t threshold_;
+    uint64_t seed_;
+    UnsignedInt *original_id_;
+};
+
+/**
+ * @class OutputFilterByVariable
+ * @brief Selects the particles whose variable satisfies a predicate,
+ * e.g. [](Real plastic_strain) { return plastic_strain > 0.01; }.
+ */
+template <typename DataType, class PredicateType>
+class OutputFilterByVariable : public BaseOutputFilter
+{
+  public:
+    OutputFilterByVariable(SPHBody &sph_body, const std::string &variable_name, const PredicateType &predicate)
+        : BaseOutputFilter(sph_body),
+          dv_variable_(addSourceVariable(particles_->getVariableByName<DataType>(variable_name))),
+          predicate_(predicate), variable_(nullptr){};
+    virtual ~OutputFilterByVariable(){};
+    virtual void setupFilter() override { variable_ = dv_variable_->DataField(); };
+    virtual bool isSelected(size_t index_i) override { return predicate_(variable_[index_i]); };
+
+  protected:
+    DiscreteVariable<DataType> *dv_variable_;
+    PredicateType predicate_;
+    DataType *variable_;
+};
+} // namespace SPH
+#endif // IO_OUTPUT_FILTER_H
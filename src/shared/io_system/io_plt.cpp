@@ -35,8 +35,90 @@ void PltEngine::writeAQuantity(std::ofstream &out_file, const Vecd &quantity)
         out_file << std::fixed << std::setprecision(9) << quantity[i] << "   ";
 }
 //=================================================================================================//
+void QuantityRecordingBuffer::setFlushInterval(size_t flush_interval)
+{
+    flush_interval_ = SMAX(flush_interval, size_t(1));
+    if (number_of_rows_ >= flush_interval_)
+        flush();
+}
+//=================================================================================================//
+void QuantityRecordingBuffer::startRow(Real run_time)
+{
+    current_column_ = 0;
+    appendToColumn(run_time);
+}
+//=================================================================================================//
+void QuantityRecordingBuffer::appendQuantity(const Real &quantity)
+{
+    appendToColumn(quantity);
+}
+//=================================================================================================//
+void QuantityRecordingBuffer::appendQuantity(const Vecd &quantity)
+{
+    for (int i = 0; i < Dimensions; ++i)
+        appendToColumn(quantity[i]);
+}
+//=================================================================================================//
+void QuantityRecordingBuffer::appendToColumn(Real value)
+{
+    if (current_column_ == quantity_columns_.size())
+    {
+        if (number_of_rows_ != 0)
+        {
+            std::cout << "\n Error: the number of recorded quantities changed in " << filefullpath_ << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        quantity_columns_.emplace_back();
+        quantity_columns_.back().reserve(flush_interval_);
+    }
+    quantity_columns_[current_column_].push_back(value);
+    current_column_++;
+}
+//=================================================================================================//
+void QuantityRecordingBuffer::closeRow()
+{
+    number_of_rows_++;
+    if (number_of_rows_ >= flush_interval_ ||
+        (TickCount::now() - last_flush_).seconds() > flush_time_interval_)
+        flush();
+}
+//=================================================================================================//
+void QuantityRecordingBuffer::flush()
+{
+    if (number_of_rows_ == 0)
+        return;
+
+    // the whole block is formatted in memory and written with a single call
+    std::string block;
+    block.reserve(number_of_rows_ * quantity_columns_.size() * 16);
+    char value[64];
+    for (size_t row = 0; row != number_of_rows_; ++row)
+    {
+        // run time is written as by default stream formatting, quantities as by PltEngine
+        std::snprintf(value, sizeof(value), "%g   ", quantity_columns_[0][row]);
+        block += value;
+        for (size_t k = 1; k < quantity_columns_.size(); ++k)
+        {
+            std::snprintf(value, sizeof(value), "%.9f   ", quantity_columns_[k][row]);
+            block += value;
+        }
+        block += "\n";
+    }
+
+    std::ofstream out_file(filefullpath_.c_str(), std::ios::app);
+    out_file.write(block.data(), block.size());
+    out_file.close();
+
+    for (size_t k = 0; k != quantity_columns_.size(); ++k)
+        quantity_columns_[k].clear();
+    number_of_rows_ = 0;
+    last_flush_ = TickCount::now();
+}
+//=================================================================================================//
 void BodyStatesRecordingToPlt::writePltFileHeader(
-    std::ofstream &output_file, ParticleVariables &variables_to_write)
+    std::ofstream &output_file, ParticleVariables &variables_to_write,
+    DerivedOutputVariables &derived_variables_to_write)
 {
     output_file << " VARIABLES = \"x\",\"y\",\"z\",\"ID\"";
 
@@ -60,10 +142,24 @@ void BodyStatesRecordingToPlt::writePltFileHeader(
     {
         output_file << ",\"" << variable->Name() << "\"";
     };
+
+    for (DerivedOutputVariable<Vecd> *variable : std::get<type_index_Vecd>(derived_variables_to_write))
+    {
+        std::string variable_name = variable->Name();
+        output_file << ",\"" << variable_name << "_x\""
+                    << ",\"" << variable_name << "_y\""
+                    << ",\"" << variable_name << "_z\"";
+    };
+
+    for (DerivedOutputVariable<Real> *variable : std::get<type_index_Real>(derived_variables_to_write))
+    {
+        output_file << ",\"" << variable->Name() << "\"";
+    };
 }
 //=================================================================================================//
 void BodyStatesRecordingToPlt::writePltFileParticleData(
-    std::ofstream &output_file, ParticleVariables &variables_to_write, Vecd *position, size_t index)
+    std::ofstream &output_file, ParticleVariables &variables_to_write,
+    DerivedOutputVariables &derived_variables_to_write, Vecd *position, size_t index)
 {
     // write particle positions and index first
     Vec3d particle_position = upgradeToVec3d(position[index]);
@@ -91,6 +187,17 @@ void BodyStatesRecordingToPlt::writePltFileParticleData(
         Real *data_field = variable->DataField();
         output_file << data_field[index] << " ";
     };
+
+    for (DerivedOutputVariable<Vecd> *variable : std::get<type_index_Vecd>(derived_variables_to_write))
+    {
+        Vec3d vector_value = upgradeToVec3d(variable->evaluate(index));
+        output_file << vector_value[0] << " " << vector_value[1] << " " << vector_value[2] << " ";
+    };
+
+    for (DerivedOutputVariable<Real> *variable : std::get<type_index_Real>(derived_variables_to_write))
+    {
+        output_file << variable->evaluate(index) << " ";
+    };
 }
 //=============================================================================================//
 void BodyStatesRecordingToPlt::writeWithFileName(const std::string &sequence)
@@ -99,6 +206,7 @@ void BodyStatesRecordingToPlt::writeWithFileName(const std::string &sequence)
     {
         BaseParticles &particles = body->getBaseParticles();
         ParticleVariables &variables_to_write = particles.VariablesToWrite();
+        DerivedOutputVariables &derived_variables_to_write = particles.DerivedVariablesToWrite();
         if (body->checkNewlyUpdated())
         {
             if (state_recording_)
@@ -110,13 +218,20 @@ void BodyStatesRecordingToPlt::writeWithFileName(const std::string &sequence)
                     fs::remove(filefullpath);
                 }
                 std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
-                writePltFileHeader(out_file, variables_to_write);
+                writePltFileHeader(out_file, variables_to_write, derived_variables_to_write);
                 out_file << "\n";
 
+                constexpr int type_index_Real = DataTypeIndex<Real>::value;
+                for (DerivedOutputVariable<Real> *variable : std::get<type_index_Real>(derived_variables_to_write))
+                    variable->setupOutput();
+                constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
+                for (DerivedOutputVariable<Vecd> *variable : std::get<type_index_Vecd>(derived_variables_to_write))
+                    variable->setupOutput();
+
                 Vecd *position = particles.ParticlePositions();
-                for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+                for (size_t i : selectOutputParticles(body))
                 {
-                    writePltFileParticleData(out_file, variables_to_write, position, i);
+                    writePltFileParticleData(out_file, variables_to_write, derived_variables_to_write, position, i);
                     out_file << "\n";
                 };
                 out_file.close();
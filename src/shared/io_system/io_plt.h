@@ -47,6 +47,66 @@ class PltEngine
     void writeAQuantityHeader(std::ofstream &out_file, const Vecd &quantity, const std::string &quantity_name);
     void writeAQuantity(std::ofstream &out_file, const Real &quantity);
     void writeAQuantity(std::ofstream &out_file, const Vecd &quantity);
+
+    /** for binned quantities, such as histograms and profiles */
+    template <int NumberOfBins>
+    void writeAQuantityHeader(std::ofstream &out_file, const Eigen::Matrix<Real, NumberOfBins, 1> &quantity,
+                              const std::string &quantity_name)
+    {
+        for (int i = 0; i != NumberOfBins; ++i)
+            out_file << "\"" << quantity_name << "[" << i << "]\""
+                     << "   ";
+    };
+    template <int NumberOfBins>
+    void writeAQuantity(std::ofstream &out_file, const Eigen::Matrix<Real, NumberOfBins, 1> &quantity)
+    {
+        for (int i = 0; i != NumberOfBins; ++i)
+            out_file << std::fixed << std::setprecision(9) << quantity[i] << "   ";
+    };
+};
+
+/**
+ * @class QuantityRecordingBuffer
+ * @brief Keeps the rows of a quantity recording file in memory column by column
+ * and appends them to the file in blocks of at most flush_interval rows.
+ * A block is also appended once flush_time_interval seconds have passed since the last one,
+ * so that the file does not lag behind a slowly recorded simulation.
+ * The rows are formatted as by PltEngine and the remaining ones are written at destruction.
+ */
+class QuantityRecordingBuffer
+{
+  public:
+    explicit QuantityRecordingBuffer(const std::string &filefullpath, size_t flush_interval = 100,
+                                     Real flush_time_interval = 10.0)
+        : filefullpath_(filefullpath), flush_interval_(SMAX(flush_interval, size_t(1))),
+          flush_time_interval_(flush_time_interval), last_flush_(TickCount::now()),
+          number_of_rows_(0), current_column_(0){};
+    virtual ~QuantityRecordingBuffer() { flush(); };
+
+    void setFlushInterval(size_t flush_interval);
+    void setFlushTimeInterval(Real flush_time_interval) { flush_time_interval_ = flush_time_interval; };
+    void startRow(Real run_time);
+    void appendQuantity(const Real &quantity);
+    void appendQuantity(const Vecd &quantity);
+    template <int NumberOfBins>
+    void appendQuantity(const Eigen::Matrix<Real, NumberOfBins, 1> &quantity)
+    {
+        for (int i = 0; i != NumberOfBins; ++i)
+            appendToColumn(quantity[i]);
+    };
+    void closeRow();
+    void flush();
+
+  protected:
+    std::string filefullpath_;
+    size_t flush_interval_;
+    Real flush_time_interval_; /**< in seconds of wall-clock time */
+    TickCount last_flush_;
+    size_t number_of_rows_;
+    StdVec<StdVec<Real>> quantity_columns_; /**< the first column is the run time */
+    size_t current_column_;
+
+    void appendToColumn(Real value);
 };
 
 /**
@@ -62,8 +122,10 @@ class BodyStatesRecordingToPlt : public BodyStatesRecording
     virtual ~BodyStatesRecordingToPlt(){};
 
   protected:
-    void writePltFileHeader(std::ofstream &output_file, ParticleVariables &variables_to_write);
-    void writePltFileParticleData(std::ofstream &output_file, ParticleVariables &variables_to_write, Vecd *position, size_t index);
+    void writePltFileHeader(std::ofstream &output_file, ParticleVariables &variables_to_write,
+                            DerivedOutputVariables &derived_variables_to_write);
+    void writePltFileParticleData(std::ofstream &output_file, ParticleVariables &variables_to_write,
+                                  DerivedOutputVariables &derived_variables_to_write, Vecd *position, size_t index);
     virtual void writeWithFileName(const std::string &sequence) override;
 };
 
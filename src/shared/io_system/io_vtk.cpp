@@ -29,15 +29,16 @@ void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
                 out_file << "<VTKFile type=\"PolyData\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
                 out_file << " <PolyData>\n";
 
-                size_t total_real_particles = base_particles.TotalRealParticles();
-                out_file << "  <Piece Name =\"" << body->getName() << "\" NumberOfPoints=\"" << total_real_particles
-                         << "\" NumberOfVerts=\"" << total_real_particles << "\">\n";
+                OutputParticles output_particles = selectOutputParticles(body);
+                size_t number_of_output_particles = output_particles.size();
+                out_file << "  <Piece Name =\"" << body->getName() << "\" NumberOfPoints=\"" << number_of_output_particles
+                         << "\" NumberOfVerts=\"" << number_of_output_particles << "\">\n";
 
                 // write current/final particle positions first
                 out_file << "   <Points>\n";
                 out_file << "    <DataArray Name=\"Position\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
                 out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+                for (size_t i : output_particles)
                 {
                     Vec3d particle_position = upgradeToVec3d(base_particles.ParticlePositions()[i]);
                     out_file << particle_position[0] << " " << particle_position[1] << " " << particle_position[2] << " ";
@@ -48,14 +49,14 @@ void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
 
                 // write header of particles data
                 out_file << "   <PointData  Vectors=\"vector\">\n";
-                writeParticlesToVtk(out_file, base_particles);
+                writeParticlesToVtk(out_file, base_particles, output_particles);
                 out_file << "   </PointData>\n";
 
                 // write empty cells
                 out_file << "   <Verts>\n";
                 out_file << "    <DataArray type=\"Int32\"  Name=\"connectivity\"  Format=\"ascii\">\n";
                 out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+                for (size_t i = 0; i != number_of_output_particles; ++i)
                 {
                     out_file << i << " ";
                 }
@@ -63,7 +64,7 @@ void BodyStatesRecordingToVtp::writeWithFileName(const std::string &sequence)
                 out_file << "    </DataArray>\n";
                 out_file << "    <DataArray type=\"Int32\"  Name=\"offsets\"  Format=\"ascii\">\n";
                 out_file << "    ";
-                for (size_t i = 0; i != total_real_particles; ++i)
+                for (size_t i = 0; i != number_of_output_particles; ++i)
                 {
                     out_file << i + 1 << " ";
                 }
@@ -108,10 +109,10 @@ void BodyStatesRecordingToVtpString::writeVtu(std::ostream &stream, SPHBody *bod
     stream << " <UnstructuredGrid>\n";
 
     BaseParticles &base_particles = body->getBaseParticles();
-    size_t total_real_particles = base_particles.TotalRealParticles();
-    stream << "  <Piece Name =\"" << body->getName() << "\" NumberOfPoints=\"" << total_real_particles << "\" NumberOfCells=\"0\">\n";
+    OutputParticles output_particles = selectOutputParticles(body);
+    stream << "  <Piece Name =\"" << body->getName() << "\" NumberOfPoints=\"" << output_particles.size() << "\" NumberOfCells=\"0\">\n";
 
-    writeParticlesToVtk(stream, base_particles);
+    writeParticlesToVtk(stream, base_particles, output_particles);
 
     stream << "   </PointData>\n";
 
@@ -51,6 +51,9 @@ class BodyStatesRecordingToVtp : public BodyStatesRecording
     virtual void writeWithFileName(const std::string &sequence) override;
     template <typename OutStreamType>
     void writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles);
+    template <typename OutStreamType>
+    void writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles,
+                             const OutputParticles &output_particles);
 };
 
 /**
@@ -9,14 +9,20 @@ namespace SPH
 template <typename OutStreamType>
 void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles)
 {
-    size_t total_real_particles = particles.TotalRealParticles();
+    writeParticlesToVtk(output_stream, particles, OutputParticles(particles.TotalRealParticles()));
+}
+//=============================================================================================//
+template <typename OutStreamType>
+void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream, BaseParticles &particles,
+                                                   const OutputParticles &output_particles)
+{
     ParticleVariables &variables_to_write = particles.VariablesToWrite();
 
     // write sorted particles ID
     output_stream
         << "    <DataArray Name=\"SortedParticle_ID\" type=\"Int32\" Format=\"ascii\">\n";
     output_stream << "    ";
-    for (size_t i = 0; i != total_real_particles; ++i)
+    for (size_t i : output_particles)
     {
         output_stream << i << " ";
     }
@@ -26,7 +32,7 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
     // write original particles ID
     output_stream << "    <DataArray Name=\"OriginalParticle_ID\" type=\"Int32\" Format=\"ascii\">\n";
     output_stream << "    ";
-    for (size_t i = 0; i != total_real_particles; ++i)
+    for (size_t i : output_particles)
     {
         output_stream << particles.ParticleOriginalIds()[i] << " ";
     }
@@ -40,7 +46,7 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         UnsignedInt *data_field = variable->DataField();
         output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Int32\" Format=\"ascii\">\n";
         output_stream << "    ";
-        for (size_t i = 0; i != total_real_particles; ++i)
+        for (size_t i : output_particles)
         {
             output_stream << std::fixed << std::setprecision(9) << data_field[i] << " ";
         }
@@ -55,7 +61,7 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         int *data_field = variable->DataField();
         output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Int32\" Format=\"ascii\">\n";
         output_stream << "    ";
-        for (size_t i = 0; i != total_real_particles; ++i)
+        for (size_t i : output_particles)
         {
             output_stream << std::fixed << std::setprecision(9) << data_field[i] << " ";
         }
@@ -70,7 +76,7 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         Real *data_field = variable->DataField();
         output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\" Format=\"ascii\">\n";
         output_stream << "    ";
-        for (size_t i = 0; i != total_real_particles; ++i)
+        for (size_t i : output_particles)
         {
             output_stream << std::fixed << std::setprecision(9) << data_field[i] << " ";
         }
@@ -85,7 +91,7 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         Vecd *data_field = variable->DataField();
         output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
         output_stream << "    ";
-        for (size_t i = 0; i != total_real_particles; ++i)
+        for (size_t i : output_particles)
         {
             Vec3d vector_value = upgradeToVec3d(data_field[i]);
             output_stream << std::fixed << std::setprecision(9) << vector_value[0] << " " << vector_value[1] << " " << vector_value[2] << " ";
@@ -101,7 +107,7 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         Matd *data_field = variable->DataField();
         output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type= \"Float32\"  NumberOfComponents=\"9\" Format=\"ascii\">\n";
         output_stream << "    ";
-        for (size_t i = 0; i != total_real_particles; ++i)
+        for (size_t i : output_particles)
         {
             Mat3d matrix_value = upgradeToMat3d(data_field[i]);
             for (int k = 0; k != 3; ++k)
@@ -113,6 +119,86 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         output_stream << std::endl;
         output_stream << "    </DataArray>\n";
     }
+
+    // write derived scalars and vectors evaluated on the fly
+    DerivedOutputVariables &derived_variables_to_write = particles.DerivedVariablesToWrite();
+    for (DerivedOutputVariable<Real> *variable : std::get<type_index_Real>(derived_variables_to_write))
+    {
+        variable->setupOutput();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i : output_particles)
+        {
+            output_stream << std::fixed << std::setprecision(9) << variable->evaluate(i) << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+
+    for (DerivedOutputVariable<Vecd> *variable : std::get<type_index_Vecd>(derived_variables_to_write))
+    {
+        variable->setupOutput();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i : output_particles)
+        {
+            Vec3d vector_value = upgradeToVec3d(variable->evaluate(i));
+            output_stream << std::fixed << std::setprecision(9) << vector_value[0] << " " << vector_value[1] << " " << vector_value[2] << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+
+#if SPHINXSYS_USE_MIXED_PRECISION
+    // write scalars, vectors and matrices stored in reduced precision
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write))
+    {
+        StorageReal *data_field = variable->DataField();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i : output_particles)
+        {
+            output_stream << std::fixed << std::setprecision(9) << Real(data_field[i]) << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+
+    constexpr int type_index_StorageVecd = DataTypeIndex<StorageVecd>::value;
+    for (DiscreteVariable<StorageVecd> *variable : std::get<type_index_StorageVecd>(variables_to_write))
+    {
+        StorageVecd *data_field = variable->DataField();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\"  NumberOfComponents=\"3\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i : output_particles)
+        {
+            Vec3d vector_value = upgradeToVec3d(Vecd(data_field[i].template cast<Real>()));
+            output_stream << std::fixed << std::setprecision(9) << vector_value[0] << " " << vector_value[1] << " " << vector_value[2] << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+
+    constexpr int type_index_StorageMatd = DataTypeIndex<StorageMatd>::value;
+    for (DiscreteVariable<StorageMatd> *variable : std::get<type_index_StorageMatd>(variables_to_write))
+    {
+        StorageMatd *data_field = variable->DataField();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type= \"Float32\"  NumberOfComponents=\"9\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i : output_particles)
+        {
+            Mat3d matrix_value = upgradeToMat3d(Matd(data_field[i].template cast<Real>()));
+            for (int k = 0; k != 3; ++k)
+            {
+                Vec3d col_vector = matrix_value.col(k);
+                output_stream << std::fixed << std::setprecision(9) << col_vector[0] << " " << col_vector[1] << " " << col_vector[2] << " ";
+            }
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+#endif
 }
 //=============================================================================================//
 } // namespace SPH
@@ -83,6 +83,37 @@ void CellLinkedList::searchNeighborsByParticles(
                  });
 }
 //=================================================================================================//
+template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
+void CellLinkedList::searchNeighborsByParticles(
+    DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
+    GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation,
+    const BoundingBox &search_bounds)
+{
+    Vecd *pos = dynamics_range.getBaseParticles().ParticlePositions();
+    particle_for(execution::ParallelPolicy(), dynamics_range.LoopRange(),
+                 [&](size_t index_i)
+                 {
+                     if (!search_bounds.checkContain(pos[index_i]))
+                         return;
+
+                     int search_depth = get_search_depth(index_i);
+                     Arrayi target_cell_index = CellIndexFromPosition(pos[index_i]);
+
+                     Neighborhood &neighborhood = particle_configuration[index_i];
+                     mesh_for_each(
+                         Arrayi::Zero().max(target_cell_index - search_depth * Arrayi::Ones()),
+                         all_cells_.min(target_cell_index + (search_depth + 1) * Arrayi::Ones()),
+                         [&](const Arrayi &cell_index)
+                         {
+                             ListDataVector &target_particles = getCellDataList(cell_data_lists_, cell_index);
+                             for (const ListData &data_list : target_particles)
+                             {
+                                 get_neighbor_relation(neighborhood, pos[index_i], index_i, data_list);
+                             }
+                         });
+                 });
+}
+//=================================================================================================//
 template <class LocalDynamicsFunction>
 void CellLinkedList::particle_for_split(const execution::SequencedPolicy &, const LocalDynamicsFunction &local_dynamics_function)
 {
@@ -34,6 +34,7 @@
 #include "all_body_relations.h"
 #include "base_body.h"
 #include "base_data_package.h"
+#include "dynamics_profiler.h"
 #include "neighborhood.h"
 #include "sphinxsys_containers.h"
 
@@ -63,8 +64,18 @@ class BaseDynamics
     /** There is the interface functions for computing. */
     virtual ReturnType exec(Real dt = 0.0) = 0;
 
+    /** The name used for profiling, the type name by default. */
+    std::string DynamicsName()
+    {
+        if (dynamics_name_.empty())
+            dynamics_name_ = DynamicsProfiler::readableTypeName(typeid(*this));
+        return dynamics_name_;
+    };
+    void setDynamicsName(const std::string &dynamics_name) { dynamics_name_ = dynamics_name; };
+
   private:
     bool is_newly_updated_;
+    std::string dynamics_name_;
 };
 
 /**
@@ -32,5 +32,6 @@
 #include "particle_sorting.hpp"
 #include "update_body_relation.hpp"
 #include "update_cell_linked_list.hpp"
+#include "update_sleeping_region.hpp"
 
 #endif // ALL_CONFIGURATION_DYNAMICS_H
\ No newline at end of file
@@ -48,6 +48,12 @@ struct AtomicUnsignedIntRef<SequencedPolicy>
     typedef UnsignedInt &type;
 };
 
+template <>
+struct AtomicUnsignedIntRef<TileStagedPolicy>
+{
+    typedef UnsignedInt &type;
+};
+
 template <>
 struct AtomicUnsignedIntRef<ParallelPolicy>
 {
@@ -26,31 +26,45 @@ void VonMisesStrain::update(size_t index_i, Real dt)
 }
 //=============================================================================================//
 VerticalStress::VerticalStress(SPHBody &sph_body)
-    : BaseDerivedVariable<Real>(sph_body, "VerticalStress"),
-      stress_tensor_3D_(particles_->getVariableDataByName<Mat3d>("StressTensor3D")) {}
+    : DerivedOutputVariable<Real>("VerticalStress"),
+      dv_stress_tensor_3D_(addSourceVariable(sph_body.getBaseParticles().getVariableByName<StorageMat3d>("StressTensor3D"))),
+      stress_tensor_3D_(nullptr) {}
 //=============================================================================================//
-void VerticalStress::update(size_t index_i, Real dt)
+void VerticalStress::setupOutput()
 {
-    derived_variable_[index_i] = stress_tensor_3D_[index_i](1, 1);
+    stress_tensor_3D_ = dv_stress_tensor_3D_->DataField();
+}
+//=============================================================================================//
+Real VerticalStress::evaluate(size_t index_i)
+{
+    return Real(stress_tensor_3D_[index_i](1, 1));
 }
 //=============================================================================================//
 AccDeviatoricPlasticStrain::AccDeviatoricPlasticStrain(SPHBody &sph_body)
-    : BaseDerivedVariable<Real>(sph_body, "AccDeviatoricPlasticStrain"),
-      plastic_continuum_(DynamicCast<PlasticContinuum>(this, sph_body_.getBaseMaterial())),
-      stress_tensor_3D_(particles_->getVariableDataByName<Mat3d>("StressTensor3D")),
-      strain_tensor_3D_(particles_->getVariableDataByName<Mat3d>("StrainTensor3D")),
+    : DerivedOutputVariable<Real>("AccDeviatoricPlasticStrain"),
+      plastic_continuum_(DynamicCast<PlasticContinuum>(this, sph_body.getBaseMaterial())),
+      dv_stress_tensor_3D_(addSourceVariable(sph_body.getBaseParticles().getVariableByName<StorageMat3d>("StressTensor3D"))),
+      dv_strain_tensor_3D_(addSourceVariable(sph_body.getBaseParticles().getVariableByName<StorageMat3d>("StrainTensor3D"))),
+      stress_tensor_3D_(nullptr), strain_tensor_3D_(nullptr),
       E_(plastic_continuum_.getYoungsModulus()), nu_(plastic_continuum_.getPoissonRatio()) {}
 //=============================================================================================//
-void AccDeviatoricPlasticStrain::update(size_t index_i, Real dt)
+void AccDeviatoricPlasticStrain::setupOutput()
+{
+    stress_tensor_3D_ = dv_stress_tensor_3D_->DataField();
+    strain_tensor_3D_ = dv_strain_tensor_3D_->DataField();
+}
+//=============================================================================================//
+Real AccDeviatoricPlasticStrain::evaluate(size_t index_i)
 {
-    Mat3d deviatoric_stress = stress_tensor_3D_[index_i] - (1.0 / 3.0) * stress_tensor_3D_[index_i].trace() * Mat3d::Identity();
-    Real hydrostatic_pressure = (1.0 / 3.0) * stress_tensor_3D_[index_i].trace();
+    Mat3d stress_tensor = stress_tensor_3D_[index_i].cast<Real>();
+    Mat3d deviatoric_stress = stress_tensor - (1.0 / 3.0) * stress_tensor.trace() * Mat3d::Identity();
+    Real hydrostatic_pressure = (1.0 / 3.0) * stress_tensor.trace();
     Mat3d elastic_strain_tensor_3D = deviatoric_stress / (2.0 * plastic_continuum_.getShearModulus(E_, nu_)) +
                                      hydrostatic_pressure * Mat3d::Identity() / (9.0 * plastic_continuum_.getBulkModulus(E_, nu_));
-    Mat3d plastic_strain_tensor_3D = strain_tensor_3D_[index_i] - elastic_strain_tensor_3D;
+    Mat3d plastic_strain_tensor_3D = strain_tensor_3D_[index_i].cast<Real>() - elastic_strain_tensor_3D;
     Mat3d deviatoric_strain_tensor = plastic_strain_tensor_3D - (1.0 / (Real)Dimensions) * plastic_strain_tensor_3D.trace() * Mat3d::Identity();
     Real sum = (deviatoric_strain_tensor.cwiseProduct(deviatoric_strain_tensor)).sum();
-    derived_variable_[index_i] = sqrt(sum * 2.0 / 3.0);
+    return sqrt(sum * 2.0 / 3.0);
 }
 //=================================================================================================//
 } // namespace continuum_dynamics
@@ -68,30 +68,36 @@ class VonMisesStrain : public BaseDerivedVariable<Real>
 };
 /**
  * @class VerticalStress
+ * @brief Output-only, evaluated when written by BodyStatesRecording::addDerivedVariableToWrite.
  */
-class VerticalStress : public BaseDerivedVariable<Real>
+class VerticalStress : public DerivedOutputVariable<Real>
 {
   public:
     explicit VerticalStress(SPHBody &sph_body);
     virtual ~VerticalStress(){};
-    void update(size_t index_i, Real dt = 0.0);
+    virtual void setupOutput() override;
+    virtual Real evaluate(size_t index_i) override;
 
   protected:
-    Mat3d *stress_tensor_3D_;
+    DiscreteVariable<StorageMat3d> *dv_stress_tensor_3D_;
+    StorageMat3d *stress_tensor_3D_;
 };
 /**
  * @class AccumulatedDeviatoricPlasticStrain
+ * @brief Output-only, evaluated when written by BodyStatesRecording::addDerivedVariableToWrite.
  */
-class AccDeviatoricPlasticStrain : public BaseDerivedVariable<Real>
+class AccDeviatoricPlasticStrain : public DerivedOutputVariable<Real>
 {
   public:
     explicit AccDeviatoricPlasticStrain(SPHBody &sph_body);
     virtual ~AccDeviatoricPlasticStrain(){};
-    void update(size_t index_i, Real dt = 0.0);
+    virtual void setupOutput() override;
+    virtual Real evaluate(size_t index_i) override;
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    Mat3d *stress_tensor_3D_, *strain_tensor_3D_;
+    DiscreteVariable<StorageMat3d> *dv_stress_tensor_3D_, *dv_strain_tensor_3D_;
+    StorageMat3d *stress_tensor_3D_, *strain_tensor_3D_;
     Real E_, nu_;
 };
 } // namespace continuum_dynamics
@@ -9,7 +9,7 @@ ContinuumInitialCondition::ContinuumInitialCondition(SPHBody &sph_body)
     : LocalDynamics(sph_body),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->registerStateVariable<Vecd>("Velocity")),
-      stress_tensor_3D_(particles_->registerStateVariable<Mat3d>("StressTensor3D")) {}
+      stress_tensor_3D_(particles_->registerStateVariable<StorageMat3d>("StressTensor3D")) {}
 //=================================================================================================//
 AcousticTimeStep::AcousticTimeStep(SPHBody &sph_body, Real acousticCFL)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
@@ -50,14 +50,14 @@ void StressDiffusion::interaction(size_t index_i, Real dt)
         Real r_ij = inner_neighborhood.r_ij_[n];
         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
         Real y_ij = pos_[index_i](1, 0) - pos_[index_j](1, 0);
-        diffusion_stress = stress_tensor_3D_[index_i] - stress_tensor_3D_[index_j];
+        diffusion_stress = (stress_tensor_3D_[index_i] - stress_tensor_3D_[index_j]).cast<Real>();
         diffusion_stress(0, 0) -= (1 - sin(phi_)) * density * gravity * y_ij;
         diffusion_stress(1, 1) -= density * gravity * y_ij;
         diffusion_stress(2, 2) -= (1 - sin(phi_)) * density * gravity * y_ij;
         diffusion_stress_rate += 2 * zeta_ * smoothing_length_ * sound_speed_ *
                                   diffusion_stress * r_ij * dW_ijV_j / (r_ij * r_ij + 0.01 * smoothing_length_);
     }
-    stress_rate_3D_[index_i] = diffusion_stress_rate;
+    stress_rate_3D_[index_i] = diffusion_stress_rate.cast<StorageReal>();
 }
 //====================================================================================//
 ShearStressRelaxationHourglassControl1stHalf ::
@@ -46,7 +46,7 @@ class ContinuumInitialCondition : public LocalDynamics
 
   protected:
     Vecd *pos_, *vel_;
-    Mat3d *stress_tensor_3D_;
+    StorageMat3d *stress_tensor_3D_;
 };
 
 class AcousticTimeStep : public LocalDynamicsReduce<ReduceMax>
@@ -89,8 +89,8 @@ class BasePlasticIntegration : public fluid_dynamics::BaseIntegration<DataDelega
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    Mat3d *stress_tensor_3D_, *strain_tensor_3D_, *stress_rate_3D_, *strain_rate_3D_;
-    Matd *velocity_gradient_;
+    StorageMat3d *stress_tensor_3D_, *strain_tensor_3D_, *stress_rate_3D_, *strain_rate_3D_;
+    StorageMatd *velocity_gradient_;
 };
 
 template <typename... InteractionTypes>
@@ -22,16 +22,16 @@ template <class BaseRelationType>
 BasePlasticIntegration<DataDelegationType>::BasePlasticIntegration(BaseRelationType &base_relation)
     : fluid_dynamics::BaseIntegration<DataDelegationType>(base_relation),
       plastic_continuum_(DynamicCast<PlasticContinuum>(this, this->particles_->getBaseMaterial())),
-      stress_tensor_3D_(this->particles_->template registerStateVariable<Mat3d>("StressTensor3D")),
-      strain_tensor_3D_(this->particles_->template registerStateVariable<Mat3d>("StrainTensor3D")),
-      stress_rate_3D_(this->particles_->template registerStateVariable<Mat3d>("StressRate3D")),
-      strain_rate_3D_(this->particles_->template registerStateVariable<Mat3d>("StrainRate3D")),
-      velocity_gradient_(this->particles_->template registerStateVariable<Matd>("VelocityGradient"))
+      stress_tensor_3D_(this->particles_->template registerStateVariable<StorageMat3d>("StressTensor3D")),
+      strain_tensor_3D_(this->particles_->template registerStateVariable<StorageMat3d>("StrainTensor3D")),
+      stress_rate_3D_(this->particles_->template registerStateVariable<StorageMat3d>("StressRate3D")),
+      strain_rate_3D_(this->particles_->template registerStateVariable<StorageMat3d>("StrainRate3D")),
+      velocity_gradient_(this->particles_->template registerStateVariable<StorageMatd>("VelocityGradient"))
 {
-    this->particles_->template addVariableToSort<Mat3d>("StrainTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StressTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StrainRate3D");
-    this->particles_->template addVariableToSort<Mat3d>("StressRate3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StrainTensor3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StressTensor3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StrainRate3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StressRate3D");
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -44,7 +44,7 @@ template <class RiemannSolverType>
 void PlasticIntegration1stHalf<Inner<>, RiemannSolverType>::initialization(size_t index_i, Real dt)
 {
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
-    p_[index_i] = -stress_tensor_3D_[index_i].trace() / 3;
+    p_[index_i] = -Real(stress_tensor_3D_[index_i].trace()) / 3;
     pos_[index_i] += vel_[index_i] * dt * 0.5;
 }
 //=================================================================================================//
@@ -70,7 +70,7 @@ void PlasticIntegration1stHalf<Inner<>, RiemannSolverType>::interaction(size_t i
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
     Real rho_i = rho_[index_i];
-    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
+    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i].template cast<Real>());
     const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
 
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
@@ -78,7 +78,7 @@ void PlasticIntegration1stHalf<Inner<>, RiemannSolverType>::interaction(size_t i
         size_t index_j = inner_neighborhood.j_[n];
         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
         Vecd nablaW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j] * inner_neighborhood.e_ij_[n];
-        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j]);
+        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j].template cast<Real>());
         force += mass_[index_i] * rho_[index_j] * ((stress_tensor_i + stress_tensor_j) / (rho_i * rho_[index_j])) * nablaW_ijV_j;
         rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
     }
@@ -104,7 +104,7 @@ void PlasticIntegration1stHalf<Contact<Wall>, RiemannSolverType>::interaction(si
     Vecd force_prior_i = computeNonConservativeForce(index_i);
     Vecd force = force_prior_i;
     Real rho_dissipation(0);
-    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
+    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i].template cast<Real>());
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         Vecd *wall_acc_ave_k = wall_acc_ave_[k];
@@ -164,7 +164,7 @@ void PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::interaction(size_t i
     }
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] = p_dissipation / rho_[index_i];
-    velocity_gradient_[index_i] = velocity_gradient;
+    velocity_gradient_[index_i] = velocity_gradient.template cast<StorageReal>();
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -172,14 +172,18 @@ void PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::update(size_t index_
 {
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
     Vol_[index_i] = mass_[index_i] / rho_[index_i];
-    Mat3d velocity_gradient = upgradeToMat3d(velocity_gradient_[index_i]);
-    Mat3d stress_tensor_rate_3D_ = plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
-    stress_rate_3D_[index_i] += stress_tensor_rate_3D_;
-    stress_tensor_3D_[index_i] += stress_rate_3D_[index_i] * dt;
+    // the constitutive update is computed in Real and only the results are stored in StorageReal
+    Mat3d velocity_gradient = upgradeToMat3d(Matd(velocity_gradient_[index_i].template cast<Real>()));
+    Mat3d stress_tensor = stress_tensor_3D_[index_i].template cast<Real>();
+    Mat3d stress_rate = stress_rate_3D_[index_i].template cast<Real>() +
+                        plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    stress_tensor += stress_rate * dt;
     /*return mapping*/
-    stress_tensor_3D_[index_i] = plastic_continuum_.ReturnMapping(stress_tensor_3D_[index_i]);
-    strain_rate_3D_[index_i] = 0.5 * (velocity_gradient + velocity_gradient.transpose());
-    strain_tensor_3D_[index_i] += strain_rate_3D_[index_i] * dt;
+    stress_rate_3D_[index_i] = stress_rate.template cast<StorageReal>();
+    stress_tensor_3D_[index_i] = plastic_continuum_.ReturnMapping(stress_tensor).template cast<StorageReal>();
+    Mat3d strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    strain_rate_3D_[index_i] = strain_rate.template cast<StorageReal>();
+    strain_tensor_3D_[index_i] += (strain_rate * dt).template cast<StorageReal>();
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -215,7 +219,7 @@ void PlasticIntegration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(si
     }
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] += p_dissipation / rho_[index_i];
-    velocity_gradient_[index_i] += velocity_gradient;
+    velocity_gradient_[index_i] += velocity_gradient.template cast<StorageReal>();
 }
 } // namespace continuum_dynamics
 } // namespace SPH
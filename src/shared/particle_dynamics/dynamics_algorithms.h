@@ -52,6 +52,7 @@
 
 #include "base_local_dynamics.h"
 #include "base_particle_dynamics.h"
+#include "batched_tensor.h"
 #include "cell_linked_list.hpp"
 #include "particle_iterators.h"
 
@@ -89,6 +90,19 @@ struct has_update<T, std::void_t<decltype(&T::update)>> : std::true_type
 {
 };
 
+/** Only a block initialization declared by the local dynamics itself, but not inherited, is recognized,
+ *  so that a derived local dynamics redefining initialization does not use that of its base class. */
+template <class T, class = void>
+struct has_block_initialization : std::false_type
+{
+};
+
+template <class T>
+struct has_block_initialization<T, std::void_t<decltype(&T::blockInitialization)>>
+    : std::is_same<decltype(&T::blockInitialization), void (T::*)(size_t, size_t, Real)>
+{
+};
+
 using namespace execution;
 
 /**
@@ -112,6 +126,7 @@ class SimpleDynamics : public LocalDynamicsType, public BaseDynamics<void>
 
     virtual void exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         particle_for(ExecutionPolicy(),
@@ -141,6 +156,7 @@ class ReduceDynamics : public LocalDynamicsType,
 
     virtual ReturnType exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         this->setupDynamics(dt);
         ReturnType temp = particle_reduce(ExecutionPolicy(),
                                           this->identifier_.LoopRange(), this->Reference(), this->getOperation(),
@@ -184,6 +200,7 @@ class BaseInteractionDynamics : public LocalDynamicsType, public BaseDynamics<vo
 
     virtual void exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         runInteraction(dt);
@@ -278,6 +295,7 @@ class InteractionWithUpdate : public InteractionDynamics<LocalDynamicsType, Exec
 
     virtual void exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         InteractionDynamics<LocalDynamicsType, ExecutionPolicy>::exec(dt);
         particle_for(ExecutionPolicy(),
                      this->identifier_.LoopRange(),
@@ -304,6 +322,7 @@ class InteractionWithInitialization : public InteractionDynamics<LocalDynamicsTy
 
     virtual void exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         particle_for(ExecutionPolicy(),
                      this->identifier_.LoopRange(),
                      [&](size_t i) { this->initialization(i, dt); });
@@ -329,12 +348,11 @@ class Dynamics1Level : public InteractionDynamics<LocalDynamicsType, ExecutionPo
 
     virtual void exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
 
-        particle_for(ExecutionPolicy(),
-                     this->identifier_.LoopRange(),
-                     [&](size_t i) { this->initialization(i, dt); });
+        runInitialization(dt);
 
         InteractionDynamics<LocalDynamicsType, ExecutionPolicy>::runInteraction(dt);
 
@@ -342,6 +360,31 @@ class Dynamics1Level : public InteractionDynamics<LocalDynamicsType, ExecutionPo
                      this->identifier_.LoopRange(),
                      [&](size_t i) { this->update(i, dt); });
     };
+
+  protected:
+    /** Local dynamics with a block initialization are initialized by blocks of BatchLanes particles. */
+    void runInitialization(Real dt)
+    {
+        using LoopRangeType = std::decay_t<decltype(this->identifier_.LoopRange())>;
+        if constexpr (has_block_initialization<LocalDynamicsType>::value &&
+                      std::is_same<LoopRangeType, IndexRange>::value)
+        {
+            IndexRange loop_range = this->identifier_.LoopRange();
+            size_t number_of_blocks = (loop_range.size() + BatchLanes - 1) / BatchLanes;
+            particle_for(ExecutionPolicy(), IndexRange(0, number_of_blocks),
+                         [&](size_t block)
+                         {
+                             size_t begin = loop_range.begin() + block * BatchLanes;
+                             this->blockInitialization(begin, SMIN(begin + BatchLanes, loop_range.end()), dt);
+                         });
+        }
+        else
+        {
+            particle_for(ExecutionPolicy(),
+                         this->identifier_.LoopRange(),
+                         [&](size_t i) { this->initialization(i, dt); });
+        }
+    };
 };
 } // namespace SPH
 #endif // DYNAMICS_ALGORITHMS_H
@@ -0,0 +1,99 @@
+#include "dynamics_profiler.h"
+
+#include <algorithm>
+#include <boost/core/demangle.hpp>
+#include <fstream>
+#include <iomanip>
+
+namespace SPH
+{
+//=================================================================================================//
+DynamicsProfiler::~DynamicsProfiler()
+{
+    writeSummary();
+}
+//=================================================================================================//
+void DynamicsProfiler::record(const std::string &dynamics_name, Real wall_time, size_t particles_processed)
+{
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    DynamicsTimingRecord &timing_record = records_[dynamics_name];
+    timing_record.call_count_++;
+    timing_record.total_time_ += wall_time;
+    timing_record.min_time_ = SMIN(timing_record.min_time_, wall_time);
+    timing_record.max_time_ = SMAX(timing_record.max_time_, wall_time);
+    timing_record.particles_processed_ += particles_processed;
+}
+//=================================================================================================//
+std::string DynamicsProfiler::readableTypeName(const std::type_info &type_info)
+{
+    std::string name = boost::core::demangle(type_info.name());
+    for (const std::string &prefix : {std::string("SPH::execution::"), std::string("SPH::")})
+    {
+        for (size_t position = name.find(prefix); position != std::string::npos;
+             position = name.find(prefix, position))
+        {
+            name.erase(position, prefix.size());
+        }
+    }
+    return name;
+}
+//=================================================================================================//
+void DynamicsProfiler::writeSummary()
+{
+    if (records_.empty() || is_summary_written_)
+        return;
+    is_summary_written_ = true;
+
+    StdVec<std::pair<std::string, DynamicsTimingRecord>> sorted_records(records_.begin(), records_.end());
+    std::sort(sorted_records.begin(), sorted_records.end(),
+              [](const auto &a, const auto &b)
+              { return a.second.total_time_ > b.second.total_time_; });
+
+    std::cout << "\n Dynamics profiling summary (inclusive wall time in seconds):\n";
+    std::cout << std::setw(12) << "calls" << std::setw(14) << "total" << std::setw(14) << "min"
+              << std::setw(14) << "max" << std::setw(16) << "particles" << "  dynamics\n";
+    for (const auto &entry : sorted_records)
+    {
+        const DynamicsTimingRecord &timing_record = entry.second;
+        std::cout << std::setw(12) << timing_record.call_count_
+                  << std::setw(14) << std::setprecision(6) << timing_record.total_time_
+                  << std::setw(14) << std::setprecision(6) << timing_record.min_time_
+                  << std::setw(14) << std::setprecision(6) << timing_record.max_time_
+                  << std::setw(16) << timing_record.particles_processed_
+                  << "  " << entry.first << "\n";
+    }
+
+    std::ofstream csv_file(output_folder_ + "/dynamics_profiling.csv", std::ios::trunc);
+    csv_file << "dynamics;calls;total_time;min_time;max_time;particles_processed\n";
+    for (const auto &entry : sorted_records)
+    {
+        const DynamicsTimingRecord &timing_record = entry.second;
+        csv_file << entry.first << ";" << timing_record.call_count_ << ";"
+                 << timing_record.total_time_ << ";" << timing_record.min_time_ << ";"
+                 << timing_record.max_time_ << ";" << timing_record.particles_processed_ << "\n";
+    }
+
+    std::ofstream json_file(output_folder_ + "/dynamics_profiling.json", std::ios::trunc);
+    json_file << "[\n";
+    for (size_t i = 0; i != sorted_records.size(); ++i)
+    {
+        const DynamicsTimingRecord &timing_record = sorted_records[i].second;
+        std::string escaped_name;
+        for (char c : sorted_records[i].first)
+        {
+            if (c == '"' || c == '\\')
+                escaped_name += '\\';
+            escaped_name += c;
+        }
+        json_file << "  {\"dynamics\": \"" << escaped_name << "\", "
+                  << "\"calls\": " << timing_record.call_count_ << ", "
+                  << "\"total_time\": " << timing_record.total_time_ << ", "
+                  << "\"min_time\": " << timing_record.min_time_ << ", "
+                  << "\"max_time\": " << timing_record.max_time_ << ", "
+                  << "\"particles_processed\": " << timing_record.particles_processed_ << "}"
+                  << (i + 1 != sorted_records.size() ? ",\n" : "\n");
+    }
+    json_file << "]\n";
+}
+//=================================================================================================//
+} // namespace SPH
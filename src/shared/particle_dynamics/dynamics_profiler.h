@@ -0,0 +1,145 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	dynamics_profiler.h
+ * @brief 	Opt-in timing and counters for the execution of particle dynamics.
+ * @details For each named dynamics, the number of calls, the total, minimum and maximum
+ *          wall time and the number of particles processed are recorded.
+ *          The times are inclusive, i.e. the time of pre- and post-processes called within
+ *          a dynamics is also counted for the calling dynamics.
+ *          The summary is printed and written to JSON and CSV files at exit.
+ *          When profiling is not activated, the overhead is a single flag check per call.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DYNAMICS_PROFILER_H
+#define DYNAMICS_PROFILER_H
+
+#include "sphinxsys_containers.h"
+#include "trace_recorder.h"
+
+#include <map>
+#include <mutex>
+#include <typeinfo>
+
+namespace SPH
+{
+struct DynamicsTimingRecord
+{
+    size_t call_count_ = 0;
+    Real total_time_ = 0.0;
+    Real min_time_ = MaxReal;
+    Real max_time_ = 0.0;
+    size_t particles_processed_ = 0;
+};
+
+class DynamicsProfiler
+{
+  public:
+    DynamicsProfiler(DynamicsProfiler const &) = delete;
+    void operator=(DynamicsProfiler const &) = delete;
+    ~DynamicsProfiler();
+
+    static DynamicsProfiler &getInstance()
+    {
+        static DynamicsProfiler instance;
+        return instance;
+    }
+
+    bool isActive() { return is_active_; };
+    void setActive(bool is_active) { is_active_ = is_active; };
+    void setOutputFolder(const std::string &output_folder) { output_folder_ = output_folder; };
+    void record(const std::string &dynamics_name, Real wall_time, size_t particles_processed);
+    void writeSummary();
+    /** a readable name from the type, i.e. without namespaces of the library */
+    static std::string readableTypeName(const std::type_info &type_info);
+
+    /** Used to avoid recording a dynamics twice when its exec calls the exec of its base class. */
+    static const void *&currentDynamics()
+    {
+        static thread_local const void *current_dynamics = nullptr;
+        return current_dynamics;
+    }
+
+  protected:
+    DynamicsProfiler() : is_active_(false), is_summary_written_(false), output_folder_("."){};
+
+    bool is_active_;
+    bool is_summary_written_;
+    std::string output_folder_;
+    std::mutex record_mutex_;
+    std::map<std::string, DynamicsTimingRecord> records_;
+} static &dynamics_profiler = DynamicsProfiler::getInstance();
+
+/**
+ * @class DynamicsProfilingScope
+ * @brief Records the wall time of a dynamics execution from construction to destruction.
+ * The execution is also recorded as a trace event when tracing is active.
+ */
+class DynamicsProfilingScope
+{
+  public:
+    template <class DynamicsType, class DynamicsIdentifier>
+    DynamicsProfilingScope(DynamicsType *dynamics, DynamicsIdentifier &identifier)
+        : is_profiled_(dynamics_profiler.isActive() &&
+                       DynamicsProfiler::currentDynamics() != dynamics),
+          is_traced_(trace_recorder.isActive() &&
+                     DynamicsProfiler::currentDynamics() != dynamics),
+          particles_processed_(0)
+    {
+        if (is_profiled_ || is_traced_)
+        {
+            enclosing_dynamics_ = DynamicsProfiler::currentDynamics();
+            DynamicsProfiler::currentDynamics() = dynamics;
+            dynamics_name_ = dynamics->DynamicsName() + "@" + identifier.getName();
+            particles_processed_ = identifier.SizeOfLoopRange();
+            trace_name_index_ = is_traced_ ? trace_recorder.internName(dynamics_name_) : 0;
+            trace_begin_ = is_traced_ ? trace_recorder.now() : 0.0;
+            start_ = TickCount::now();
+        }
+    };
+    ~DynamicsProfilingScope()
+    {
+        if (is_profiled_ || is_traced_)
+        {
+            TimeInterval wall_time = TickCount::now() - start_;
+            if (is_profiled_)
+                dynamics_profiler.record(dynamics_name_, wall_time.seconds(), particles_processed_);
+            if (is_traced_)
+                trace_recorder.record(trace_name_index_, trace_begin_, wall_time.seconds() * 1.0e6);
+            DynamicsProfiler::currentDynamics() = enclosing_dynamics_;
+        }
+    };
+
+  protected:
+    bool is_profiled_;
+    bool is_traced_;
+    size_t trace_name_index_ = 0;
+    double trace_begin_ = 0.0;
+    const void *enclosing_dynamics_ = nullptr;
+    std::string dynamics_name_;
+    size_t particles_processed_;
+    TickCount start_;
+};
+} // namespace SPH
+#endif // DYNAMICS_PROFILER_H
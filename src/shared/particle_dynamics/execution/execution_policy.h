@@ -32,6 +32,8 @@
 
 namespace SPH
 {
+class TileStaging;
+
 namespace execution
 {
 class SequencedPolicy
@@ -54,6 +56,14 @@ class ParallelDevicePolicy
 {
 };
 
+/** Host policy with which a computing kernel accesses the staged particle data of a tile. */
+class TileStagedPolicy
+{
+  public:
+    explicit TileStagedPolicy(TileStaging &tile_staging) : tile_staging_(tile_staging){};
+    TileStaging &tile_staging_;
+};
+
 inline constexpr auto seq = SequencedPolicy{};
 inline constexpr auto unseq = UnsequencedPolicy{};
 inline constexpr auto par = ParallelPolicy{};
@@ -33,5 +33,5 @@
 #pragma once
 
 #include "near_wall_boundary.h"
-#include "fluid_boundary.h"
+#include "fluid_boundary.hpp"
 #include "non_reflective_boundary.h"
@@ -254,6 +254,53 @@ class DisposerOutflowDeletion : public BaseLocalDynamics<BodyPartByCell>
     Vecd *pos_;
     AlignedBoxShape &aligned_box_;
 };
+
+/**
+ * @class BatchedEmitterInflowInjection
+ * @brief Inject particles in two phases without mutex exclusion.
+ * The particles crossing the upper bound are first flagged in parallel,
+ * then compacted by an exclusive scan and appended as new real particles
+ * by a bulk copy of the particle states.
+ */
+template <class ExecutionPolicy>
+class BatchedEmitterInflowInjection : public EmitterInflowInjection, public BaseDynamics<void>
+{
+  public:
+    BatchedEmitterInflowInjection(BodyAlignedBoxByParticle &aligned_box_part, ParticleBuffer<Base> &buffer);
+    virtual ~BatchedEmitterInflowInjection(){};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    StdVec<UnsignedInt> crossing_flag_, crossing_offset_;
+    StdVec<UnsignedInt> crossing_particles_, new_particles_;
+};
+
+/**
+ * @class BatchedDisposerOutflowDeletion
+ * @brief Delete particles in two phases without mutex exclusion.
+ * The particles running out of the domain are first gathered in parallel.
+ * Then the holes they leave below the new number of real particles are
+ * filled by the remaining particles beyond it, matched by exclusive scans
+ * and moved by a bulk copy of the particle states.
+ */
+template <class ExecutionPolicy>
+class BatchedDisposerOutflowDeletion : public DisposerOutflowDeletion, public BaseDynamics<void>
+{
+  public:
+    BatchedDisposerOutflowDeletion(BodyAlignedBoxByCell &aligned_box_part);
+    virtual ~BatchedDisposerOutflowDeletion(){};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    UnsignedInt *original_id_;
+    UnsignedInt *sorted_id_;
+    StdVec<UnsignedInt> cell_count_, cell_offset_;
+    StdVec<UnsignedInt> deleted_particles_, deletion_flag_;
+    StdVec<UnsignedInt> scan_flag_, scan_offset_;
+    StdVec<UnsignedInt> holes_, movers_;
+};
 } // namespace fluid_dynamics
 } // namespace SPH
 #endif // FLUID_BOUNDARY_H
\ No newline at end of file
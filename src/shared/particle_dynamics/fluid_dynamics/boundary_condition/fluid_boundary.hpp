@@ -0,0 +1,194 @@
+#ifndef FLUID_BOUNDARY_HPP
+#define FLUID_BOUNDARY_HPP
+
+#include "fluid_boundary.h"
+
+namespace SPH
+{
+namespace fluid_dynamics
+{
+//=================================================================================================//
+template <class ExecutionPolicy>
+BatchedEmitterInflowInjection<ExecutionPolicy>::
+    BatchedEmitterInflowInjection(BodyAlignedBoxByParticle &aligned_box_part, ParticleBuffer<Base> &buffer)
+    : EmitterInflowInjection(aligned_box_part, buffer), BaseDynamics<void>()
+{
+    // not implemented for device policy as the particle states are copied
+    // on host by the plain particle loops of sequenced or parallel policy
+    static_assert(std::is_same<ExecutionPolicy, execution::SequencedPolicy>::value ||
+                      std::is_same<ExecutionPolicy, execution::ParallelPolicy>::value,
+                  "This dynamics is only designed for execution::SequencedPolicy or execution::ParallelPolicy!");
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void BatchedEmitterInflowInjection<ExecutionPolicy>::exec(Real dt)
+{
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
+    this->setUpdated(this->identifier_.getSPHBody());
+
+    IndexVector &body_part_particles = this->identifier_.LoopRange();
+    UnsignedInt number_of_particles = body_part_particles.size();
+    crossing_flag_.resize(number_of_particles + 1);
+    crossing_offset_.resize(number_of_particles + 1);
+    UnsignedInt *crossing_flag = crossing_flag_.data();
+    UnsignedInt *crossing_offset = crossing_offset_.data();
+
+    particle_for(ex_policy_, IndexRange(0, number_of_particles),
+                 [&](size_t k)
+                 {
+                     size_t sorted_index_k = sorted_id_[body_part_particles[k]];
+                     crossing_flag[k] = aligned_box_.checkUpperBound(pos_[sorted_index_k]) ? 1 : 0;
+                 });
+    crossing_flag[number_of_particles] = 0;
+    UnsignedInt total_crossing_particles =
+        exclusive_scan(ex_policy_, crossing_flag, crossing_offset, number_of_particles + 1, std::plus<UnsignedInt>());
+    if (total_crossing_particles == 0)
+        return;
+
+    buffer_.checkEnoughBuffer(*particles_, total_crossing_particles);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    crossing_particles_.resize(total_crossing_particles);
+    new_particles_.resize(total_crossing_particles);
+    UnsignedInt *crossing_particles = crossing_particles_.data();
+    UnsignedInt *new_particles = new_particles_.data();
+    particle_for(ex_policy_, IndexRange(0, number_of_particles),
+                 [&](size_t k)
+                 {
+                     if (crossing_flag[k] == 1)
+                     {
+                         UnsignedInt new_original_id = total_real_particles + crossing_offset[k];
+                         crossing_particles[crossing_offset[k]] = sorted_id_[body_part_particles[k]];
+                         new_particles[crossing_offset[k]] = new_original_id;
+                         original_id_[new_original_id] = new_original_id;
+                     }
+                 });
+    particles_->copyFromAnotherParticles(ex_policy_, new_particles, crossing_particles, total_crossing_particles);
+    particles_->incrementTotalRealParticles(total_crossing_particles);
+
+    /** Periodic bounding. */
+    particle_for(ex_policy_, IndexRange(0, total_crossing_particles),
+                 [&](size_t n)
+                 {
+                     UnsignedInt sorted_index_i = crossing_particles[n];
+                     pos_[sorted_index_i] = aligned_box_.getUpperPeriodic(pos_[sorted_index_i]);
+                     rho_[sorted_index_i] = fluid_.ReferenceDensity();
+                     p_[sorted_index_i] = fluid_.getPressure(rho_[sorted_index_i]);
+                 });
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+BatchedDisposerOutflowDeletion<ExecutionPolicy>::
+    BatchedDisposerOutflowDeletion(BodyAlignedBoxByCell &aligned_box_part)
+    : DisposerOutflowDeletion(aligned_box_part), BaseDynamics<void>(),
+      original_id_(particles_->ParticleOriginalIds()),
+      sorted_id_(particles_->ParticleSortedIds())
+{
+    // not implemented for device policy as the particle states are copied
+    // on host by the plain particle loops of sequenced or parallel policy
+    static_assert(std::is_same<ExecutionPolicy, execution::SequencedPolicy>::value ||
+                      std::is_same<ExecutionPolicy, execution::ParallelPolicy>::value,
+                  "This dynamics is only designed for execution::SequencedPolicy or execution::ParallelPolicy!");
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void BatchedDisposerOutflowDeletion<ExecutionPolicy>::exec(Real dt)
+{
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
+    this->setUpdated(this->identifier_.getSPHBody());
+
+    ConcurrentCellLists &body_part_cells = this->identifier_.LoopRange();
+    UnsignedInt number_of_cells = body_part_cells.size();
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    cell_count_.resize(number_of_cells + 1);
+    cell_offset_.resize(number_of_cells + 1);
+    UnsignedInt *cell_count = cell_count_.data();
+    UnsignedInt *cell_offset = cell_offset_.data();
+    auto is_deleted = [&](size_t index_i)
+    { return index_i < total_real_particles && aligned_box_.checkUpperBound(pos_[index_i]); };
+
+    // gather the deleted particles cell by cell
+    particle_for(ex_policy_, IndexRange(0, number_of_cells),
+                 [&](size_t c)
+                 {
+                     UnsignedInt count = 0;
+                     for (size_t index_i : *body_part_cells[c])
+                         count += is_deleted(index_i) ? 1 : 0;
+                     cell_count[c] = count;
+                 });
+    cell_count[number_of_cells] = 0;
+    UnsignedInt total_deleted_particles =
+        exclusive_scan(ex_policy_, cell_count, cell_offset, number_of_cells + 1, std::plus<UnsignedInt>());
+    if (total_deleted_particles == 0)
+        return;
+
+    deleted_particles_.resize(total_deleted_particles);
+    deletion_flag_.resize(particles_->ParticlesBound(), 0);
+    UnsignedInt *deleted_particles = deleted_particles_.data();
+    UnsignedInt *deletion_flag = deletion_flag_.data();
+    particle_for(ex_policy_, IndexRange(0, number_of_cells),
+                 [&](size_t c)
+                 {
+                     UnsignedInt position = cell_offset[c];
+                     for (size_t index_i : *body_part_cells[c])
+                         if (is_deleted(index_i))
+                         {
+                             deleted_particles[position++] = index_i;
+                             deletion_flag[index_i] = 1;
+                         }
+                 });
+
+    // holes are the deleted particles below the new number of real particles,
+    // and movers are the remaining particles beyond it, both are of the same number
+    UnsignedInt new_total_real_particles = total_real_particles - total_deleted_particles;
+    scan_flag_.resize(total_deleted_particles + 1);
+    scan_offset_.resize(total_deleted_particles + 1);
+    holes_.resize(total_deleted_particles);
+    movers_.resize(total_deleted_particles);
+    UnsignedInt *scan_flag = scan_flag_.data();
+    UnsignedInt *scan_offset = scan_offset_.data();
+    UnsignedInt *holes = holes_.data();
+    UnsignedInt *movers = movers_.data();
+
+    particle_for(ex_policy_, IndexRange(0, total_deleted_particles),
+                 [&](size_t n)
+                 { scan_flag[n] = deleted_particles[n] < new_total_real_particles ? 1 : 0; });
+    scan_flag[total_deleted_particles] = 0;
+    UnsignedInt total_holes =
+        exclusive_scan(ex_policy_, scan_flag, scan_offset, total_deleted_particles + 1, std::plus<UnsignedInt>());
+    particle_for(ex_policy_, IndexRange(0, total_deleted_particles),
+                 [&](size_t n)
+                 {
+                     if (scan_flag[n] == 1)
+                         holes[scan_offset[n]] = deleted_particles[n];
+                 });
+
+    particle_for(ex_policy_, IndexRange(0, total_deleted_particles),
+                 [&](size_t n)
+                 { scan_flag[n] = deletion_flag[new_total_real_particles + n] == 0 ? 1 : 0; });
+    scan_flag[total_deleted_particles] = 0;
+    exclusive_scan(ex_policy_, scan_flag, scan_offset, total_deleted_particles + 1, std::plus<UnsignedInt>());
+    particle_for(ex_policy_, IndexRange(0, total_deleted_particles),
+                 [&](size_t n)
+                 {
+                     if (scan_flag[n] == 1)
+                         movers[scan_offset[n]] = new_total_real_particles + n;
+                 });
+
+    particles_->copyFromAnotherParticles(ex_policy_, holes, movers, total_holes);
+    particle_for(ex_policy_, IndexRange(0, total_holes),
+                 [&](size_t n)
+                 {
+                     // update original and sorted_id as well
+                     std::swap(original_id_[holes[n]], original_id_[movers[n]]);
+                     sorted_id_[original_id_[holes[n]]] = holes[n];
+                 });
+
+    particle_for(ex_policy_, IndexRange(0, total_deleted_particles),
+                 [&](size_t n)
+                 { deletion_flag[deleted_particles[n]] = 0; });
+    particles_->decrementTotalRealParticles(total_deleted_particles);
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // FLUID_BOUNDARY_HPP
@@ -276,6 +276,13 @@ struct ReduceSum
     ReturnType operator()(const ReturnType &x, const ReturnType &y) const { return x + y; };
 };
 
+template <class ReturnType>
+struct ReduceMaxComponents
+{
+    ReturnType reference_ = -MaxReal * ReturnType::Ones();
+    ReturnType operator()(const ReturnType &x, const ReturnType &y) const { return x.cwiseMax(y); };
+};
+
 struct ReduceMax
 {
     Real reference_ = MinReal;
@@ -323,5 +330,14 @@ struct ReduceUpperBound
         return upper_bound;
     };
 };
+
+struct ReduceBoundingBox
+{
+    BoundingBox reference_ = BoundingBox(MaxReal * Vecd::Ones(), -MaxReal * Vecd::Ones());
+    BoundingBox operator()(const BoundingBox &x, const BoundingBox &y) const
+    {
+        return BoundingBox(x.first_.cwiseMin(y.first_), x.second_.cwiseMax(y.second_));
+    };
+};
 } // namespace SPH
 #endif // PARTICLE_FUNCTORS_H
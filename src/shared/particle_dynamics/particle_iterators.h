@@ -31,7 +31,9 @@
 
 #include "base_data_package.h"
 #include "execution.h"
+#include "numa_partitioner.h"
 #include "sphinxsys_containers.h"
+#include "trace_recorder.h"
 
 #include <numeric>
 
@@ -56,6 +58,7 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const SequencedPolicy &seq, const IndexRange &particles_range,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
+    TraceScope trace_scope("particle_for");
     for (size_t i = particles_range.begin(); i < particles_range.end(); ++i)
         local_dynamics_function(i);
 };
@@ -64,16 +67,17 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelPolicy &par, const IndexRange &particles_range,
                          const LocalDynamicsFunction &local_dynamics_function)
 {
-    parallel_for(
+    TraceScope trace_scope("particle_for");
+    partitioned_parallel_for(
         particles_range,
         [&](const IndexRange &r)
         {
+            TraceScope chunk_trace_scope("particle_for_chunk");
             for (size_t i = r.begin(); i < r.end(); ++i)
             {
                 local_dynamics_function(i);
             }
-        },
-        ap);
+        });
 };
 
 /**
@@ -183,6 +187,7 @@ inline ReturnType particle_reduce(const SequencedPolicy &seq, const IndexRange &
                                   ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
+    TraceScope trace_scope("particle_reduce");
     for (size_t i = particles_range.begin(); i < particles_range.end(); ++i)
     {
         temp = operation(temp, local_dynamics_function(i));
@@ -195,10 +200,12 @@ inline ReturnType particle_reduce(const ParallelPolicy &par, const IndexRange &p
                                   ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
+    TraceScope trace_scope("particle_reduce");
     return parallel_reduce(
         particles_range,
         temp, [&](const IndexRange &r, ReturnType temp0) -> ReturnType
         {
+				TraceScope chunk_trace_scope("particle_reduce_chunk");
 				for (size_t i = r.begin(); i != r.end(); ++i)
 				{
 					temp0 = operation(temp0, local_dynamics_function(i));
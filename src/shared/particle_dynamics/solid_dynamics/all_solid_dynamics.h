@@ -37,5 +37,6 @@
 #include "inelastic_dynamics.h"
 #include "loading_dynamics.h"
 #include "solid_dynamics_variable.h"
+#include "static_inner_configuration.h"
 #include "thin_structure_dynamics.h"
 #include "thin_structure_math.h"
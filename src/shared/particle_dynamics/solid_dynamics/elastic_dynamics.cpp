@@ -101,6 +101,29 @@ void Integration1stHalfPK2::initialization(size_t index_i, Real dt)
     stress_PK1_B_[index_i] = elastic_solid_.StressPK1(F_[index_i], index_i) * B_[index_i].transpose();
 }
 //=================================================================================================//
+void Integration1stHalfPK2::blockInitialization(size_t begin, size_t end, Real dt)
+{
+    int size = end - begin;
+    BatchedMatd<> F, stress_PK1, B, stress_PK1_B, cofactor;
+    BatchedReal<> J;
+    for (size_t index_i = begin; index_i != end; ++index_i)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+        // the constitutive relation is given by the material for each particle
+        stress_PK1_B_[index_i] = elastic_solid_.StressPK1(F_[index_i], index_i);
+    }
+    F.load(F_, begin, size);
+    batchedCofactor(F, cofactor);
+    batchedDeterminant(F, cofactor, J);
+    stress_PK1.load(stress_PK1_B_, begin, size);
+    B.load(B_, begin, size);
+    batchedProductTransposed(stress_PK1, B, stress_PK1_B);
+    stress_PK1_B.store(stress_PK1_B_, begin, size);
+    for (int l = 0; l != size; ++l)
+        rho_[begin + l] = rho0_ / J[l];
+}
+//=================================================================================================//
 Integration1stHalfKirchhoff::
     Integration1stHalfKirchhoff(BaseInnerRelation &inner_relation)
     : Integration1stHalf(inner_relation){};
@@ -167,6 +190,35 @@ void DecomposedIntegration1stHalf::initialization(size_t index_i, Real dt)
         elastic_solid_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_, index_i) * inverse_F_T_[index_i];
 }
 //=================================================================================================//
+void DecomposedIntegration1stHalf::blockInitialization(size_t begin, size_t end, Real dt)
+{
+    int size = end - begin;
+    BatchedMatd<> F, inverse_F_T;
+    BatchedReal<> J, F_squared_norm;
+    for (size_t index_i = begin; index_i != end; ++index_i)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+    }
+    F.load(F_, begin, size);
+    batchedInverseTranspose(F, inverse_F_T, J);
+    batchedSquaredNorm(F, F_squared_norm); // trace of F * F^T
+    inverse_F_T.store(inverse_F_T_, begin, size);
+
+    for (int l = 0; l != size; ++l)
+    {
+        size_t index_i = begin + l;
+        Real one_over_J = 1.0 / J[l];
+        rho_[index_i] = rho0_ * one_over_J;
+        J_to_minus_2_over_dimension_[index_i] = pow(one_over_J * one_over_J, OneOverDimensions);
+        stress_on_particle_[index_i] =
+            inverse_F_T_[index_i] * (elastic_solid_.VolumetricKirchhoff(J[l]) -
+                                     correction_factor_ * elastic_solid_.ShearModulus() * J_to_minus_2_over_dimension_[index_i] *
+                                         F_squared_norm[l] * OneOverDimensions) +
+            elastic_solid_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_, index_i) * inverse_F_T_[index_i];
+    }
+}
+//=================================================================================================//
 void Integration2ndHalf::initialization(size_t index_i, Real dt)
 {
     pos_[index_i] += vel_[index_i] * dt * 0.5;
@@ -185,5 +237,16 @@ void Integration1stHalfPK2RightCauchy::initialization(size_t index_i, Real dt)
     stress_PK1_B_[index_i] += F_[index_i] * 0.5 * numerical_dissipation_factor_ * numerical_damping_stress;
 }
 //=================================================================================================//
+void Integration1stHalfPK2RightCauchy::blockInitialization(size_t begin, size_t end, Real dt)
+{
+    Integration1stHalfPK2::blockInitialization(begin, end, dt);
+    // add damping stress
+    for (size_t index_i = begin; index_i != end; ++index_i)
+    {
+        const Matd numerical_damping_stress = elastic_solid_.NumericalDampingRightCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_ / h_ratio_[index_i], index_i);
+        stress_PK1_B_[index_i] += F_[index_i] * 0.5 * numerical_dissipation_factor_ * numerical_damping_stress;
+    }
+}
+//=================================================================================================//
 } // namespace solid_dynamics
 } // namespace SPH
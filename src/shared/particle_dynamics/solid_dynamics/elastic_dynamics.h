@@ -36,6 +36,7 @@
 #include "base_kernel.h"
 #include "elastic_solid.h"
 #include "solid_body.h"
+#include "static_inner_configuration.h"
 
 namespace SPH
 {
@@ -106,10 +107,37 @@ class DeformationGradientBySummation : public LocalDynamics, public DataDelegate
     explicit DeformationGradientBySummation(BaseInnerRelation &inner_relation);
     virtual ~DeformationGradientBySummation(){};
 
+    /** use the pre-computed pair data, which should be built after the correction matrix */
+    void useStaticConfiguration(StaticInnerConfiguration &static_configuration)
+    {
+        static_configuration.checkValidity();
+        static_configuration.checkCorrectionMatrix();
+        static_configuration_ = &static_configuration;
+    };
+    virtual void setupDynamics(Real dt = 0.0) override
+    {
+        if (static_configuration_ != nullptr)
+            static_configuration_->checkValidity();
+    };
+
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
         Vecd &pos_n_i = pos_[index_i];
 
+        if (static_configuration_ != nullptr)
+        {
+            Matd deformation = Matd::Zero();
+            for (UnsignedInt n = static_configuration_->FirstNeighbor(index_i);
+                 n != static_configuration_->LastNeighbor(index_i); ++n)
+            {
+                size_t index_j = static_configuration_->NeighborIndex()[n];
+                Vecd corrected_gradient = static_configuration_->CorrectedGradient()[n].template cast<Real>();
+                deformation -= (pos_n_i - pos_[index_j]) * corrected_gradient.transpose();
+            }
+            F_[index_i] = deformation;
+            return;
+        }
+
         Matd deformation = Matd::Zero();
         Neighborhood &inner_neighborhood = inner_configuration_[index_i];
         for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
@@ -127,6 +155,7 @@ class DeformationGradientBySummation : public LocalDynamics, public DataDelegate
     Real *Vol_;
     Vecd *pos_;
     Matd *B_, *F_;
+    StaticInnerConfiguration *static_configuration_ = nullptr;
 };
 
 /**
@@ -138,11 +167,24 @@ class BaseElasticIntegration : public LocalDynamics, public DataDelegateInner
   public:
     explicit BaseElasticIntegration(BaseInnerRelation &inner_relation);
     virtual ~BaseElasticIntegration(){};
+    /** use the pre-computed pair data, which should be built after the correction matrix */
+    void useStaticConfiguration(StaticInnerConfiguration &static_configuration)
+    {
+        static_configuration.checkValidity();
+        static_configuration.checkCorrectionMatrix();
+        static_configuration_ = &static_configuration;
+    };
+    virtual void setupDynamics(Real dt = 0.0) override
+    {
+        if (static_configuration_ != nullptr)
+            static_configuration_->checkValidity();
+    };
 
   protected:
     Real *Vol_;
     Vecd *pos_, *vel_, *force_;
     Matd *B_, *F_, *dF_dt_;
+    StaticInnerConfiguration *static_configuration_ = nullptr;
 };
 
 /**
@@ -178,6 +220,12 @@ class Integration1stHalf : public BaseIntegration1stHalf
 
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
+        if (static_configuration_ != nullptr)
+        {
+            force_[index_i] = forceFromStaticConfiguration(index_i);
+            return;
+        }
+
         // including gravity and force from fluid
         Vecd force = Vecd::Zero();
         const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
@@ -206,6 +254,29 @@ class Integration1stHalf : public BaseIntegration1stHalf
     Matd *stress_PK1_B_;
     Real numerical_dissipation_factor_;
     Real inv_W0_ = 1.0 / sph_body_.sph_adaptation_->getKernel()->W0(ZeroVecd);
+
+    inline Vecd forceFromStaticConfiguration(size_t index_i)
+    {
+        Vecd force = Vecd::Zero();
+        for (UnsignedInt n = static_configuration_->FirstNeighbor(index_i);
+             n != static_configuration_->LastNeighbor(index_i); ++n)
+        {
+            size_t index_j = static_configuration_->NeighborIndex()[n];
+            Vecd gradient = static_configuration_->Gradient()[n].template cast<Real>();
+            Real dim_r_ij_1 = Dimensions * Real(static_configuration_->InverseDistance()[n]);
+            Vecd pos_jump = pos_[index_i] - pos_[index_j];
+            Vecd vel_jump = vel_[index_i] - vel_[index_j];
+            Real strain_rate = dim_r_ij_1 * dim_r_ij_1 * pos_jump.dot(vel_jump);
+            Real weight = Real(static_configuration_->KernelValue()[n]) * inv_W0_;
+            Matd numerical_stress_ij =
+                0.5 * (F_[index_i] + F_[index_j]) * elastic_solid_.PairNumericalDamping(strain_rate, smoothing_length_);
+            force += mass_[index_i] * inv_rho0_ *
+                     (stress_PK1_B_[index_i] + stress_PK1_B_[index_j] +
+                      numerical_dissipation_factor_ * weight * numerical_stress_ij) *
+                     gradient;
+        }
+        return force;
+    };
 };
 
 /**
@@ -218,6 +289,8 @@ class Integration1stHalfPK2 : public Integration1stHalf
     explicit Integration1stHalfPK2(BaseInnerRelation &inner_relation);
     virtual ~Integration1stHalfPK2(){};
     void initialization(size_t index_i, Real dt = 0.0);
+    /** initialization of the particles [begin, end) with batched tensor kernels */
+    void blockInitialization(size_t begin, size_t end, Real dt = 0.0);
 };
 
 /** @class Integration1stHalfCauchy
@@ -264,9 +337,17 @@ class DecomposedIntegration1stHalf : public BaseIntegration1stHalf
     explicit DecomposedIntegration1stHalf(BaseInnerRelation &inner_relation);
     virtual ~DecomposedIntegration1stHalf(){};
     void initialization(size_t index_i, Real dt = 0.0);
+    /** initialization of the particles [begin, end) with batched tensor kernels */
+    void blockInitialization(size_t begin, size_t end, Real dt = 0.0);
 
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
+        if (static_configuration_ != nullptr)
+        {
+            force_[index_i] = forceFromStaticConfiguration(index_i);
+            return;
+        }
+
         // including gravity and force from fluid
         Vecd force = Vecd::Zero();
         const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
@@ -286,6 +367,24 @@ class DecomposedIntegration1stHalf : public BaseIntegration1stHalf
     Real *J_to_minus_2_over_dimension_;
     Matd *stress_on_particle_, *inverse_F_T_;
     const Real correction_factor_ = 1.07;
+
+    inline Vecd forceFromStaticConfiguration(size_t index_i)
+    {
+        Vecd force = Vecd::Zero();
+        for (UnsignedInt n = static_configuration_->FirstNeighbor(index_i);
+             n != static_configuration_->LastNeighbor(index_i); ++n)
+        {
+            size_t index_j = static_configuration_->NeighborIndex()[n];
+            Vecd gradient = static_configuration_->Gradient()[n].template cast<Real>();
+            Vecd shear_force_ij = correction_factor_ * elastic_solid_.ShearModulus() *
+                                  (J_to_minus_2_over_dimension_[index_i] + J_to_minus_2_over_dimension_[index_j]) *
+                                  (pos_[index_i] - pos_[index_j]) * Real(static_configuration_->InverseDistance()[n]);
+            force += mass_[index_i] * ((stress_on_particle_[index_i] + stress_on_particle_[index_j]) * gradient +
+                                       shear_force_ij * Real(static_configuration_->KernelGradient()[n])) *
+                     inv_rho0_;
+        }
+        return force;
+    };
 };
 
 /**
@@ -299,10 +398,24 @@ class Integration1stHalfPK2RightCauchy : public Integration1stHalfPK2
         : Integration1stHalfPK2(inner_relation),
           h_ratio_(particles_->registerStateVariable<Real>("SmoothingLengthRatio", Real(1.0))){};
     void initialization(size_t index_i, Real dt = 0.0);
+    void blockInitialization(size_t begin, size_t end, Real dt = 0.0);
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
         // including gravity and force from fluid
         Vecd force = Vecd::Zero();
+        if (static_configuration_ != nullptr)
+        {
+            for (UnsignedInt n = static_configuration_->FirstNeighbor(index_i);
+                 n != static_configuration_->LastNeighbor(index_i); ++n)
+            {
+                size_t index_j = static_configuration_->NeighborIndex()[n];
+                Vecd gradient = static_configuration_->Gradient()[n].template cast<Real>();
+                force += mass_[index_i] * inv_rho0_ * (stress_PK1_B_[index_i] + stress_PK1_B_[index_j]) * gradient;
+            }
+            force_[index_i] = force;
+            return;
+        }
+
         const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
         for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
         {
@@ -336,6 +449,20 @@ class Integration2ndHalf : public BaseElasticIntegration
     {
         const Vecd &vel_n_i = vel_[index_i];
 
+        if (static_configuration_ != nullptr)
+        {
+            Matd deformation_gradient_change_rate = Matd::Zero();
+            for (UnsignedInt n = static_configuration_->FirstNeighbor(index_i);
+                 n != static_configuration_->LastNeighbor(index_i); ++n)
+            {
+                size_t index_j = static_configuration_->NeighborIndex()[n];
+                Vecd corrected_gradient = static_configuration_->CorrectedGradient()[n].template cast<Real>();
+                deformation_gradient_change_rate -= (vel_n_i - vel_[index_j]) * corrected_gradient.transpose();
+            }
+            dF_dt_[index_i] = deformation_gradient_change_rate;
+            return;
+        }
+
         Matd deformation_gradient_change_rate = Matd::Zero();
         const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
         for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
@@ -32,6 +32,37 @@ void DecomposedPlasticIntegration1stHalf::initialization(size_t index_i, Real dt
         0.125 * plastic_solid_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_, index_i) * inverse_F_T;
 }
 //=================================================================================================//
+void DecomposedPlasticIntegration1stHalf::blockInitialization(size_t begin, size_t end, Real dt)
+{
+    int size = end - begin;
+    BatchedMatd<> F, inverse_F_T, normalized_be, scaling_matrix;
+    BatchedReal<> J;
+    for (size_t index_i = begin; index_i != end; ++index_i)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+        // the plastic flow is given by the material for each particle
+        scaling_matrix_[index_i] = plastic_solid_.ElasticLeftCauchy(F_[index_i], index_i, dt);
+    }
+    F.load(F_, begin, size);
+    batchedInverseTranspose(F, inverse_F_T, J);
+    normalized_be.load(scaling_matrix_, begin, size);
+    batchedProduct(normalized_be, inverse_F_T, scaling_matrix);
+    scaling_matrix.store(scaling_matrix_, begin, size);
+
+    for (int l = 0; l != size; ++l)
+    {
+        size_t index_i = begin + l;
+        rho_[index_i] = rho0_ / J[l];
+        Matd inverse_F_T_i = inverse_F_T.lane(l);
+        inverse_F_[index_i] = inverse_F_T_i.transpose();
+        Real isotropic_stress = plastic_solid_.ShearModulus() * normalized_be.lane(l).trace() * OneOverDimensions;
+        stress_on_particle_[index_i] =
+            inverse_F_T_i * (plastic_solid_.VolumetricKirchhoff(J[l]) - isotropic_stress) +
+            0.125 * plastic_solid_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_, index_i) * inverse_F_T_i;
+    }
+}
+//=================================================================================================//
 } // namespace solid_dynamics
   //=====================================================================================================//
 } // namespace SPH
@@ -47,9 +47,17 @@ class DecomposedPlasticIntegration1stHalf
     DecomposedPlasticIntegration1stHalf(BaseInnerRelation &inner_relation);
     virtual ~DecomposedPlasticIntegration1stHalf(){};
     void initialization(size_t index_i, Real dt = 0.0);
+    /** initialization of the particles [begin, end) with batched tensor kernels */
+    void blockInitialization(size_t begin, size_t end, Real dt = 0.0);
 
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
+        if (static_configuration_ != nullptr)
+        {
+            force_[index_i] = forceFromStaticConfiguration(index_i);
+            return;
+        }
+
         // including gravity and force from fluid
         Vecd force = Vecd::Zero();
         const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
@@ -77,6 +85,33 @@ class DecomposedPlasticIntegration1stHalf
   protected:
     PlasticSolid &plastic_solid_;
     Matd *scaling_matrix_, *inverse_F_;
+
+    inline Vecd forceFromStaticConfiguration(size_t index_i)
+    {
+        Vecd force = Vecd::Zero();
+        for (UnsignedInt n = static_configuration_->FirstNeighbor(index_i);
+             n != static_configuration_->LastNeighbor(index_i); ++n)
+        {
+            Real dW_ijV_j = static_configuration_->KernelGradient()[n];
+            if (dW_ijV_j == 0.0) // no contribution, and no direction to recover from the gradient
+                continue;
+
+            size_t index_j = static_configuration_->NeighborIndex()[n];
+            Vecd e_ij = static_configuration_->Gradient()[n].template cast<Real>() / dW_ijV_j;
+            Vecd pair_distance = pos_[index_i] - pos_[index_j];
+            Matd pair_scaling = scaling_matrix_[index_i] + scaling_matrix_[index_j];
+            Matd pair_inverse_F = 0.5 * (inverse_F_[index_i] + inverse_F_[index_j]);
+            Vecd e_ij_difference = pair_inverse_F * pair_distance * Real(static_configuration_->InverseDistance()[n]) - e_ij;
+            Real e_ij_difference_norm = e_ij_difference.norm();
+
+            Real limiter = SMIN(10.0 * SMAX(e_ij_difference_norm - 0.05, 0.0), 1.0);
+
+            Vecd shear_force_ij = plastic_solid_.ShearModulus() * pair_scaling * (e_ij + limiter * e_ij_difference);
+            force += mass_[index_i] * ((stress_on_particle_[index_i] + stress_on_particle_[index_j]) * e_ij + shear_force_ij) *
+                     dW_ijV_j * inv_rho0_;
+        }
+        return force;
+    };
 };
 } // namespace solid_dynamics
 } // namespace SPH
@@ -0,0 +1,95 @@
+#include "static_inner_configuration.h"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+//=================================================================================================//
+StaticInnerConfiguration::StaticInnerConfiguration(BaseInnerRelation &inner_relation)
+    : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
+      BaseDynamics<void>(), is_built_(false),
+      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")) {}
+//=================================================================================================//
+void StaticInnerConfiguration::exec(Real dt)
+{
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
+    UnsignedInt total_real_particles = particles_->TotalRealParticles();
+    pair_count_.resize(total_real_particles + 1);
+    offset_.resize(total_real_particles + 1);
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                 [&](size_t index_i)
+                 { pair_count_[index_i] = inner_configuration_[index_i].current_size_; });
+    pair_count_[total_real_particles] = 0;
+    UnsignedInt total_pairs = exclusive_scan(execution::ParallelPolicy(), pair_count_.data(), offset_.data(),
+                                             total_real_particles + 1, std::plus<UnsignedInt>());
+
+    neighbor_index_.resize(total_pairs);
+    gradient_.resize(total_pairs);
+    corrected_gradient_.resize(total_pairs);
+    kernel_gradient_.resize(total_pairs);
+    kernel_value_.resize(total_pairs);
+    inverse_distance_.resize(total_pairs);
+    built_B_.resize(total_real_particles);
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                 [&](size_t index_i)
+                 {
+                     const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+                     built_B_[index_i] = B_[index_i];
+                     Matd B_T = B_[index_i].transpose();
+                     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+                     {
+                         UnsignedInt pair = offset_[index_i] + n;
+                         size_t index_j = inner_neighborhood.j_[n];
+                         Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
+                         Vecd gradient = dW_ijV_j * inner_neighborhood.e_ij_[n];
+                         neighbor_index_[pair] = index_j;
+                         gradient_[pair] = gradient.template cast<StorageReal>();
+                         corrected_gradient_[pair] = (B_T * gradient).template cast<StorageReal>();
+                         kernel_gradient_[pair] = dW_ijV_j;
+                         kernel_value_[pair] = inner_neighborhood.W_ij_[n];
+                         inverse_distance_[pair] = 1.0 / inner_neighborhood.r_ij_[n];
+                     }
+                 });
+    is_built_ = true;
+}
+//=================================================================================================//
+void StaticInnerConfiguration::checkValidity()
+{
+    if (!is_built_)
+    {
+        std::cout << "\n Error: the static inner configuration of " << sph_body_.getName()
+                  << " is used before it is built!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    if (particles_->TotalRealParticles() != built_B_.size())
+    {
+        std::cout << "\n Error: the particle number of " << sph_body_.getName()
+                  << " is changed since the static inner configuration is built!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+#ifndef NDEBUG
+    checkCorrectionMatrix();
+#endif
+}
+//=================================================================================================//
+void StaticInnerConfiguration::checkCorrectionMatrix()
+{
+    bool is_changed = particle_reduce(execution::ParallelPolicy(), IndexRange(0, built_B_.size()),
+                                      false, ReduceOR(),
+                                      [&](size_t index_i)
+                                      { return B_[index_i] != built_B_[index_i]; });
+    if (is_changed)
+    {
+        std::cout << "\n Error: the correction matrix of " << sph_body_.getName()
+                  << " is changed since the static inner configuration is built!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+} // namespace solid_dynamics
+} // namespace SPH
@@ -0,0 +1,90 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	static_inner_configuration.h
+ * @brief 	Pre-computed inner configuration for total Lagrangian solid dynamics.
+ * @details As the reference configuration of a total Lagrangian solid is not updated,
+ *          the kernel gradients, including the volume of the neighbor and the correction matrix,
+ *          are computed once and packed in a compressed-row layout.
+ *          The solid dynamics using it stream the pair data sequentially
+ *          instead of reading the generic neighborhoods, the correction matrix and the volume.
+ *          The pair data are stored in StorageReal, i.e. in float with mixed-precision build.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef STATIC_INNER_CONFIGURATION_H
+#define STATIC_INNER_CONFIGURATION_H
+
+#include "all_body_relations.h"
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+/**
+ * @class StaticInnerConfiguration
+ * @brief Packed pair data of the inner configuration of a total Lagrangian solid.
+ * It should be executed after the configuration and the correction matrix are obtained,
+ * and again whenever one of them is changed. The dynamics using it check the correction matrix
+ * when the configuration is set and the particle number at each step.
+ * Debug builds, i.e. without NDEBUG, check the correction matrix at each step too.
+ */
+class StaticInnerConfiguration : public LocalDynamics, public DataDelegateInner, public BaseDynamics<void>
+{
+  public:
+    explicit StaticInnerConfiguration(BaseInnerRelation &inner_relation);
+    virtual ~StaticInnerConfiguration(){};
+    virtual void exec(Real dt = 0.0) override;
+    bool isBuilt() { return is_built_; };
+    /** terminate if the pair data are not built or the particle number is changed since then */
+    void checkValidity();
+    /** terminate if the correction matrix is changed since the pair data are built */
+    void checkCorrectionMatrix();
+
+    UnsignedInt FirstNeighbor(size_t index_i) const { return offset_[index_i]; };
+    UnsignedInt LastNeighbor(size_t index_i) const { return offset_[index_i + 1]; };
+    UnsignedInt *NeighborIndex() { return neighbor_index_.data(); };
+    StorageVecd *Gradient() { return gradient_.data(); };
+    StorageVecd *CorrectedGradient() { return corrected_gradient_.data(); };
+    StorageReal *KernelGradient() { return kernel_gradient_.data(); };
+    StorageReal *KernelValue() { return kernel_value_.data(); };
+    StorageReal *InverseDistance() { return inverse_distance_.data(); };
+
+  protected:
+    bool is_built_;
+    Real *Vol_;
+    Matd *B_;
+    StdLargeVec<UnsignedInt> pair_count_;        /**< number of pairs of each particle, size total + 1 */
+    StdLargeVec<UnsignedInt> offset_;            /**< first pair of each particle, size total + 1 */
+    StdLargeVec<UnsignedInt> neighbor_index_;    /**< index j */
+    StdLargeVec<StorageVecd> gradient_;          /**< dW_ij * V_j * e_ij */
+    StdLargeVec<StorageVecd> corrected_gradient_; /**< B_i^T * dW_ij * V_j * e_ij */
+    StdLargeVec<StorageReal> kernel_gradient_;   /**< dW_ij * V_j */
+    StdLargeVec<StorageReal> kernel_value_;      /**< W_ij */
+    StdLargeVec<StorageReal> inverse_distance_;  /**< 1 / r_ij */
+    StdLargeVec<Matd> built_B_;                  /**< correction matrix when the pair data are built */
+};
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // STATIC_INNER_CONFIGURATION_H
@@ -115,5 +115,19 @@ class ParticleGenerator<ParticlesType, Reload> : public ParticleGenerator<Partic
     virtual void setAllParticleBounds() override;
     virtual void initializeParticleVariables() override;
 };
+
+class Checkpoint;
+template <typename ParticlesType> // generate particles directly from a checkpoint written by CheckpointIO
+class ParticleGenerator<ParticlesType, Checkpoint> : public ParticleGenerator<ParticlesType>
+{
+    std::string file_path_;
+
+  public:
+    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, size_t checkpoint_step);
+    virtual ~ParticleGenerator(){};
+    virtual void prepareGeometricData() override;
+    virtual void setAllParticleBounds() override;
+    virtual void initializeParticleVariables() override;
+};
 } // namespace SPH
 #endif // BASE_PARTICLE_GENERATOR_H
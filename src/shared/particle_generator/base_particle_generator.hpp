@@ -43,5 +43,41 @@ void ParticleGenerator<ParticlesType, Reload>::initializeParticleVariables()
     ParticleGenerator<ParticlesType>::initializeParticleVariablesFromReload();
 }
 //=================================================================================================//
+template <typename ParticlesType>
+ParticleGenerator<ParticlesType, Checkpoint>::
+    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, size_t checkpoint_step)
+    : ParticleGenerator<ParticlesType>(sph_body, particles)
+{
+    std::ostringstream padded_step;
+    padded_step << std::setw(10) << std::setfill('0') << checkpoint_step;
+    file_path_ = sph_body.getSPHSystem().getIOEnvironment().restart_folder_ + "/" +
+                 sph_body.getName() + "_ckp_" + padded_step.str() + ".xml";
+    if (!fs::exists(file_path_))
+    {
+        std::cout << "\n Error: the checkpoint file:" << file_path_ << " is not exists" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+template <typename ParticlesType>
+void ParticleGenerator<ParticlesType, Checkpoint>::prepareGeometricData()
+{
+    // a checkpoint file is a reload file with all particle states
+    this->base_particles_.readReloadXmlFile(file_path_);
+}
+//=================================================================================================//
+template <typename ParticlesType>
+void ParticleGenerator<ParticlesType, Checkpoint>::setAllParticleBounds()
+{
+    this->base_particles_.initializeAllParticlesBoundsFromReloadXml();
+};
+//=================================================================================================//
+template <typename ParticlesType>
+void ParticleGenerator<ParticlesType, Checkpoint>::initializeParticleVariables()
+{
+    ParticleGenerator<ParticlesType>::initializeParticleVariablesFromReload();
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // BASE_PARTICLE_GENERATOR_HPP
@@ -15,12 +15,15 @@ BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
       pos_(nullptr), Vol_(nullptr), rho_(nullptr), mass_(nullptr),
       sph_body_(sph_body), body_name_(sph_body.getName()),
       base_material_(*base_material),
-      restart_xml_parser_("xml_restart", "particles"),
       reload_xml_parser_("xml_particle_reload", "particles"),
       copy_particle_state_(all_state_data_),
-      write_restart_variable_to_xml_(variables_to_restart_, restart_xml_parser_),
+      copy_particle_states_(all_state_data_),
       write_reload_variable_to_xml_(variables_to_reload_, reload_xml_parser_),
-      read_restart_variable_from_xml_(variables_to_restart_, restart_xml_parser_)
+      collect_restart_variable_records_(variables_to_restart_),
+      write_restart_variable_to_binary_(variables_to_restart_),
+      read_restart_variable_from_binary_(variables_to_restart_),
+      write_checkpoint_variable_to_xml_(all_discrete_variables_),
+      read_checkpoint_variable_from_xml_(all_discrete_variables_)
 {
     sph_body.assignBaseParticles(this);
     v_total_real_particles_ = registerSingularVariable<UnsignedInt>("TotalRealParticles");
@@ -69,6 +72,17 @@ void BaseParticles::initializeAllParticlesBoundsFromReloadXml()
     initializeAllParticlesBounds(reload_xml_parser_.Size(reload_xml_parser_.first_element_));
 }
 //=================================================================================================//
+UnsignedInt BaseParticles::BufferSizeFromReloadXml()
+{
+    // only checkpoint files record the particle bounds
+    if (reload_xml_parser_.first_element_->Attribute("RealParticlesBound") == nullptr)
+        return 0;
+
+    UnsignedInt real_particles_bound = 0;
+    reload_xml_parser_.queryAttributeValue(reload_xml_parser_.first_element_, "RealParticlesBound", real_particles_bound);
+    return real_particles_bound - reload_xml_parser_.Size(reload_xml_parser_.first_element_);
+}
+//=================================================================================================//
 void BaseParticles::increaseAllParticlesBounds(size_t buffer_size)
 {
     real_particles_bound_ += buffer_size;
@@ -129,21 +143,58 @@ void BaseParticles::resizeXmlDocForParticles(XmlParser &xml_parser)
     }
 }
 //=================================================================================================//
-void BaseParticles::writeParticlesToXmlForRestart(std::string &filefullpath)
+void BaseParticles::writeBinaryHeaderForRestart(std::ostream &out_stream)
 {
-    resizeXmlDocForParticles(restart_xml_parser_);
-    write_restart_variable_to_xml_();
-    restart_xml_parser_.writeToXmlFile(filefullpath);
+    StdVec<std::pair<std::string, UnsignedInt>> records;
+    collect_restart_variable_records_(records);
+    UnsignedInt header[2] = {TotalRealParticles(), UnsignedInt(records.size())};
+    out_stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+    for (const auto &record : records)
+    {
+        UnsignedInt name_size = record.first.size();
+        out_stream.write(reinterpret_cast<const char *>(&name_size), sizeof(UnsignedInt));
+        out_stream.write(record.first.data(), name_size);
+        out_stream.write(reinterpret_cast<const char *>(&record.second), sizeof(UnsignedInt));
+    }
 }
 //=================================================================================================//
-void BaseParticles::readParticleFromXmlForRestart(std::string &filefullpath)
+void BaseParticles::readParticlesFromBinaryForRestart(std::string &filefullpath)
 {
-    restart_xml_parser_.loadXmlFile(filefullpath);
-    read_restart_variable_from_xml_(this);
+    std::ifstream in_file(filefullpath, std::ios::in | std::ios::binary);
+    UnsignedInt header[2] = {0, 0};
+    in_file.read(reinterpret_cast<char *>(header), sizeof(header));
+
+    // the file is only read by the same case with the same restart variables
+    StdVec<std::pair<std::string, UnsignedInt>> records;
+    collect_restart_variable_records_(records);
+    bool is_matched = !in_file.fail() && header[0] <= real_particles_bound_ && header[1] == records.size();
+    for (size_t i = 0; is_matched && i != records.size(); ++i)
+    {
+        UnsignedInt name_size = 0;
+        in_file.read(reinterpret_cast<char *>(&name_size), sizeof(UnsignedInt));
+        is_matched = !in_file.fail() && name_size == records[i].first.size();
+        if (is_matched)
+        {
+            std::string name(name_size, ' ');
+            UnsignedInt data_type_size = 0;
+            in_file.read(&name[0], name_size);
+            in_file.read(reinterpret_cast<char *>(&data_type_size), sizeof(UnsignedInt));
+            is_matched = !in_file.fail() && name == records[i].first && data_type_size == records[i].second;
+        }
+    }
+    if (!is_matched)
+    {
+        std::cout << "\n Error: the restart file " << filefullpath
+                  << " does not match the restart variables of " << body_name_ << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    read_restart_variable_from_binary_(this, in_file, header[0]);
 }
 //=================================================================================================//
 void BaseParticles::writeToXmlForReloadParticle(std::string &filefullpath)
 {
+    reload_file_path_.clear();
     resizeXmlDocForParticles(reload_xml_parser_);
     write_reload_variable_to_xml_();
     reload_xml_parser_.writeToXmlFile(filefullpath);
@@ -152,8 +203,49 @@ void BaseParticles::writeToXmlForReloadParticle(std::string &filefullpath)
 XmlParser &BaseParticles::readReloadXmlFile(const std::string &filefullpath)
 {
     is_reload_file_read_ = true;
+    reload_file_path_ = filefullpath;
     reload_xml_parser_.loadXmlFile(filefullpath);
     return reload_xml_parser_;
 }
 //=================================================================================================//
+void BaseParticles::writeParticlesToXmlForCheckpoint(std::string &filefullpath)
+{
+    // a new document each time, as the number of real particles may have changed
+    XmlParser checkpoint_xml_parser("xml_checkpoint", "particles");
+    UnsignedInt total_real_particles = TotalRealParticles();
+    checkpoint_xml_parser.setAttributeToElement(
+        checkpoint_xml_parser.first_element_, "TotalRealParticles", total_real_particles);
+    checkpoint_xml_parser.setAttributeToElement(
+        checkpoint_xml_parser.first_element_, "RealParticlesBound", real_particles_bound_);
+    checkpoint_xml_parser.resize(checkpoint_xml_parser.first_element_, total_real_particles, "particle");
+    write_checkpoint_variable_to_xml_(checkpoint_xml_parser, particles_bound_);
+    checkpoint_xml_parser.writeToXmlFile(filefullpath);
+}
+//=================================================================================================//
+void BaseParticles::readParticlesFromXmlForCheckpoint(std::string &filefullpath)
+{
+    // the checkpoint is parsed already if the particles are generated from it
+    if (reload_file_path_ != filefullpath)
+    {
+        reload_file_path_ = filefullpath;
+        reload_xml_parser_.loadXmlFile(filefullpath);
+    }
+    size_t total_real_particles = reload_xml_parser_.Size(reload_xml_parser_.first_element_);
+    if (total_real_particles > real_particles_bound_)
+    {
+        std::cout << "\n Error: the checkpoint " << filefullpath << " has " << total_real_particles
+                  << " particles but only " << real_particles_bound_ << " are allowed for " << body_name_ << "!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    v_total_real_particles_->setValue(total_real_particles);
+    read_checkpoint_variable_from_xml_(reload_xml_parser_, particles_bound_);
+
+    // particles are recorded in their sorted order, so that only the sorted ids need to be rebuilt
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        sorted_id_[original_id_[i]] = i;
+    }
+}
+//=================================================================================================//
 } // namespace SPH
@@ -34,6 +34,7 @@
 #define BASE_PARTICLES_H
 
 #include "base_data_package.h"
+#include "numa_partitioner.h"
 #include "sphinxsys_containers.h"
 #include "sphinxsys_variable.h"
 #include "xml_parser.h"
@@ -84,6 +85,7 @@ class BaseParticles
     DataContainerUniquePtrAssemble<DiscreteVariable> all_discrete_variable_ptrs_;
     DataContainerUniquePtrAssemble<SingularVariable> all_global_variable_ptrs_;
     UniquePtrsKeeper<Entity> unique_variable_ptrs_;
+    DataContainerUniquePtrAssemble<DerivedOutputVariable> derived_output_variable_ptrs_;
 
   public:
     explicit BaseParticles(SPHBody &sph_body, BaseMaterial *base_material);
@@ -110,14 +112,19 @@ class BaseParticles
     // Generalized particle manipulation
     //----------------------------------------------------------------------
     UnsignedInt TotalRealParticles() { return *v_total_real_particles_->ValueAddress(); };
-    void incrementTotalRealParticles(UnsignedInt increment = 1) { *v_total_real_particles_->ValueAddress() += increment; };
-    void decrementTotalRealParticles(UnsignedInt decrement = 1) { *v_total_real_particles_->ValueAddress() -= decrement; };
+    void incrementTotalRealParticles(UnsignedInt increment = 1) { v_total_real_particles_->incrementValue(increment); };
+    void decrementTotalRealParticles(UnsignedInt decrement = 1) { v_total_real_particles_->setValue(TotalRealParticles() - decrement); };
     UnsignedInt RealParticlesBound() { return real_particles_bound_; };
     UnsignedInt ParticlesBound() { return particles_bound_; };
     void initializeAllParticlesBounds(size_t total_real_particles);
     void initializeAllParticlesBoundsFromReloadXml();
+    UnsignedInt BufferSizeFromReloadXml();
     void increaseAllParticlesBounds(size_t buffer_size);
     void copyFromAnotherParticle(size_t index, size_t another_index);
+    /** copy the states of a batch of particles, variable by variable, from the particles given by another_indexes */
+    template <class ExecutionPolicy>
+    void copyFromAnotherParticles(const ExecutionPolicy &ex_policy, UnsignedInt *indexes,
+                                  UnsignedInt *another_indexes, UnsignedInt batch_size);
     size_t allocateGhostParticles(size_t ghost_size);
     void updateGhostParticle(size_t ghost_index, size_t index);
     void switchToBufferParticle(size_t index);
@@ -128,6 +135,7 @@ class BaseParticles
   private:
     template <typename DataType>
     DataType *initializeVariable(DiscreteVariable<DataType> *variable, DataType initial_value = ZeroData<DataType>::value);
+    /** The initialization function is called in parallel only with active NUMA partitioning. */
     template <typename DataType, class InitializationFunction>
     DataType *initializeVariable(DiscreteVariable<DataType> *variable, const InitializationFunction &initialization);
     template <typename DataType>
@@ -174,6 +182,9 @@ class BaseParticles
     void addVariableToWrite(const std::string &name);
     template <typename DataType>
     void addVariableToWrite(DiscreteVariable<DataType> *variable);
+    /** add an output-only variable evaluated only when the particles are written */
+    template <class DerivedOutputType, typename... Args>
+    void addDerivedVariableToWrite(Args &&...args);
     template <typename DataType>
     void addVariableToRestart(const std::string &name);
 
@@ -204,10 +215,17 @@ class BaseParticles
     //----------------------------------------------------------------------
     void writeParticlesToPltFile(std::ofstream &output_file);
     void resizeXmlDocForParticles(XmlParser &xml_parser);
-    void writeParticlesToXmlForRestart(std::string &filefullpath);
-    void readParticleFromXmlForRestart(std::string &filefullpath);
+    /** write the restart variables of the real particles in binary, without formatting */
+    template <class ExecutionPolicy>
+    void writeParticlesToBinaryForRestart(const ExecutionPolicy &ex_policy, std::ostream &out_stream);
+    void readParticlesFromBinaryForRestart(std::string &filefullpath);
     void writeToXmlForReloadParticle(std::string &filefullpath);
     XmlParser &readReloadXmlFile(const std::string &filefullpath);
+    /** write all particle states, particle bounds and sort order for restarting without particle generation */
+    void writeParticlesToXmlForCheckpoint(std::string &filefullpath);
+    /** restore all registered particle states found in the checkpoint file,
+     *  which is not parsed again if the particles have been generated from it */
+    void readParticlesFromXmlForCheckpoint(std::string &filefullpath);
     template <typename OwnerType>
     void checkReloadFileRead(OwnerType *owner);
     //----------------------------------------------------------------------
@@ -229,18 +247,26 @@ class BaseParticles
     SPHBody &sph_body_;
     std::string body_name_;
     BaseMaterial &base_material_;
-    XmlParser restart_xml_parser_;
     XmlParser reload_xml_parser_;
+    std::string reload_file_path_; /**< the file last loaded to the reload parser */
     ParticleData all_state_data_; /**< all discrete variable data except those on particle IDs  */
     ParticleVariables all_discrete_variables_;
     SingularVariables all_singular_variables_;
     ParticleVariables variables_to_write_;
     ParticleVariables variables_to_restart_;
     ParticleVariables variables_to_reload_;
+    DerivedOutputVariables derived_variables_to_write_;
     bool is_reload_file_read_ = false;
 
+    template <typename DataType>
+    void checkNotDerivedVariableToWrite(const std::string &name);
+    /** the number of real particles and the name and type size of the restart variables */
+    void writeBinaryHeaderForRestart(std::ostream &out_stream);
+
   public:
+    ParticleVariables &AllDiscreteVariables() { return all_discrete_variables_; };
     ParticleVariables &VariablesToWrite() { return variables_to_write_; };
+    DerivedOutputVariables &DerivedVariablesToWrite() { return derived_variables_to_write_; };
     ParticleVariables &VariablesToRestart() { return variables_to_restart_; };
     ParticleVariables &VariablesToReload() { return variables_to_reload_; };
     ParticleVariables &VariablesToSort() { return variables_to_sort_; };
@@ -255,6 +281,13 @@ class BaseParticles
         void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t index, size_t another_index);
     };
 
+    struct CopyParticleStates
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, const ExecutionPolicy &ex_policy,
+                        UnsignedInt *indexes, UnsignedInt *another_indexes, UnsignedInt batch_size);
+    };
+
     struct WriteAParticleVariableToXml
     {
         XmlParser &xml_parser_;
@@ -264,18 +297,49 @@ class BaseParticles
         void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables);
     };
 
-    struct ReadAParticleVariableFromXml
+    struct WriteAParticleVariableToCheckpoint
     {
-        XmlParser &xml_parser_;
-        ReadAParticleVariableFromXml(XmlParser &xml_parser) : xml_parser_(xml_parser){};
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        XmlParser &xml_parser, UnsignedInt particles_bound);
+    };
+
+    struct ReadAParticleVariableFromCheckpoint
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        XmlParser &xml_parser, UnsignedInt particles_bound);
+    };
+
+    struct CollectAParticleVariableRecord
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        StdVec<std::pair<std::string, UnsignedInt>> &records);
+    };
 
+    struct WriteAParticleVariableToBinary
+    {
+        template <typename DataType, class ExecutionPolicy>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        const ExecutionPolicy &ex_policy, std::ostream &out_stream, UnsignedInt total_real_particles);
+    };
+
+    struct ReadAParticleVariableFromBinary
+    {
         template <typename DataType>
-        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles);
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BaseParticles *base_particles, std::istream &in_stream, UnsignedInt total_real_particles);
     };
 
     OperationOnDataAssemble<ParticleData, CopyParticleState> copy_particle_state_;
-    OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_restart_variable_to_xml_, write_reload_variable_to_xml_;
-    OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromXml> read_restart_variable_from_xml_;
+    OperationOnDataAssemble<ParticleData, CopyParticleStates> copy_particle_states_;
+    OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_reload_variable_to_xml_;
+    OperationOnDataAssemble<ParticleVariables, CollectAParticleVariableRecord> collect_restart_variable_records_;
+    OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToBinary> write_restart_variable_to_binary_;
+    OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromBinary> read_restart_variable_from_binary_;
+    OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToCheckpoint> write_checkpoint_variable_to_xml_;
+    OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromCheckpoint> read_checkpoint_variable_from_xml_;
 };
 } // namespace SPH
 #endif // BASE_PARTICLES_H
@@ -2,6 +2,7 @@
 #define BASE_PARTICLES_HPP
 
 #include "base_particles.h"
+#include "particle_iterators.h"
 
 namespace SPH
 {
@@ -17,14 +18,26 @@ void BaseParticles::checkReloadFileRead(OwnerType *owner)
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy>
+void BaseParticles::writeParticlesToBinaryForRestart(const ExecutionPolicy &ex_policy, std::ostream &out_stream)
+{
+    writeBinaryHeaderForRestart(out_stream);
+    write_restart_variable_to_binary_(ex_policy, out_stream, TotalRealParticles());
+}
+//=================================================================================================//
 template <typename DataType>
 DataType *BaseParticles::initializeVariable(DiscreteVariable<DataType> *variable, DataType initial_value)
 {
     DataType *data_field = variable->DataField();
-    for (size_t i = 0; i != variable->getDataFieldSize(); ++i)
-    {
-        data_field[i] = initial_value;
-    }
+    first_touch_for(
+        IndexRange(0, variable->getDataFieldSize()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                data_field[i] = initial_value;
+            }
+        });
     return data_field;
 }
 //=================================================================================================//
@@ -33,10 +46,15 @@ DataType *BaseParticles::
     initializeVariable(DiscreteVariable<DataType> *variable, const InitializationFunction &initialization)
 {
     DataType *data_field = initializeVariable(variable);
-    for (size_t i = 0; i != variable->getDataFieldSize(); ++i)
-    {
-        data_field[i] = initialization(i); // Here, function object is applied for initialization.
-    }
+    first_touch_for(
+        IndexRange(0, variable->getDataFieldSize()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                data_field[i] = initialization(i); // Here, function object is applied for initialization.
+            }
+        });
     return data_field;
 }
 //=================================================================================================//
@@ -46,10 +64,15 @@ DataType *BaseParticles::initializeVariable(
 {
     DataType *data_field = variable->DataField();
     DataType *old_data_field = old_variable->DataField();
-    for (size_t i = 0; i != variable->getDataFieldSize(); ++i)
-    {
-        data_field[i] = old_data_field[i];
-    }
+    first_touch_for(
+        IndexRange(0, variable->getDataFieldSize()),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                data_field[i] = old_data_field[i];
+            }
+        });
     return data_field;
 }
 //=================================================================================================//
@@ -278,15 +301,45 @@ void BaseParticles::addVariableToSort(const std::string &name)
 template <typename DataType>
 void BaseParticles::addVariableToWrite(const std::string &name)
 {
+    checkNotDerivedVariableToWrite<DataType>(name);
     addVariableToList<DataType>(variables_to_write_, name);
 }
 //=================================================================================================//
 template <typename DataType>
 void BaseParticles::addVariableToWrite(DiscreteVariable<DataType> *variable)
 {
+    checkNotDerivedVariableToWrite<DataType>(variable->Name());
     addVariableToList<DataType>(variables_to_write_, variable);
 }
 //=================================================================================================//
+template <class DerivedOutputType, typename... Args>
+void BaseParticles::addDerivedVariableToWrite(Args &&...args)
+{
+    using DataType = typename DerivedOutputType::ValueType;
+    constexpr int type_index = DataTypeIndex<DataType>::value;
+    DerivedOutputType *variable = std::get<type_index>(derived_output_variable_ptrs_)
+                                      .template createPtr<DerivedOutputType>(std::forward<Args>(args)...);
+    checkNotDerivedVariableToWrite<DataType>(variable->Name());
+    if (findVariableByName<DataType>(variables_to_write_, variable->Name()) != nullptr)
+    {
+        std::cout << "\n Error: the variable '" << variable->Name() << "' is already to write!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    std::get<type_index>(derived_variables_to_write_).push_back(variable);
+}
+//=================================================================================================//
+template <typename DataType>
+void BaseParticles::checkNotDerivedVariableToWrite(const std::string &name)
+{
+    if (findVariableByName<DataType>(derived_variables_to_write_, name) != nullptr)
+    {
+        std::cout << "\n Error: the derived variable '" << name << "' is already to write!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
 template <typename DataType>
 void BaseParticles::addVariableToRestart(const std::string &name)
 {
@@ -309,6 +362,27 @@ operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t ind
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy>
+void BaseParticles::copyFromAnotherParticles(const ExecutionPolicy &ex_policy, UnsignedInt *indexes,
+                                             UnsignedInt *another_indexes, UnsignedInt batch_size)
+{
+    copy_particle_states_(ex_policy, indexes, another_indexes, batch_size);
+}
+//=================================================================================================//
+template <typename DataType, class ExecutionPolicy>
+void BaseParticles::CopyParticleStates::
+operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, const ExecutionPolicy &ex_policy,
+           UnsignedInt *indexes, UnsignedInt *another_indexes, UnsignedInt batch_size)
+{
+    for (size_t k = 0; k != data_keeper.size(); ++k)
+    {
+        DataType *data_field = data_keeper[k];
+        particle_for(ex_policy, IndexRange(0, batch_size),
+                     [=](size_t i)
+                     { data_field[indexes[i]] = data_field[another_indexes[i]]; });
+    }
+}
+//=================================================================================================//
 template <typename DataType>
 void BaseParticles::WriteAParticleVariableToXml::
 operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables)
@@ -326,22 +400,92 @@ operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables)
 }
 //=================================================================================================//
 template <typename DataType>
-void BaseParticles::ReadAParticleVariableFromXml::
-operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles)
+void BaseParticles::WriteAParticleVariableToCheckpoint::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           XmlParser &xml_parser, UnsignedInt particles_bound)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        // UnsignedInt variables are particle IDs or work arrays, only the original IDs are kept
+        if constexpr (std::is_same_v<DataType, UnsignedInt>)
+        {
+            if (variables[i]->Name() != "OriginalID")
+                continue;
+        }
+
+        DataType *data_field = variables[i]->DataField();
+        if (data_field == nullptr || variables[i]->getDataFieldSize() < particles_bound)
+            continue;
+
+        size_t index = 0;
+        for (auto child = xml_parser.first_element_->FirstChildElement(); child; child = child->NextSiblingElement())
+        {
+            xml_parser.setAttributeToElement(child, variables[i]->Name(), data_field[index]);
+            index++;
+        }
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void BaseParticles::ReadAParticleVariableFromCheckpoint::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           XmlParser &xml_parser, UnsignedInt particles_bound)
 {
+    tinyxml2::XMLElement *first_child = xml_parser.first_element_->FirstChildElement();
+    if (first_child == nullptr)
+        return;
+
     for (size_t i = 0; i != variables.size(); ++i)
     {
+        DataType *data_field = variables[i]->DataField();
+        if (data_field == nullptr || variables[i]->getDataFieldSize() < particles_bound ||
+            first_child->Attribute(variables[i]->Name().c_str()) == nullptr)
+            continue;
+
         size_t index = 0;
-        DataType *data_field = variables[i]->DataField() != nullptr
-                                   ? variables[i]->DataField()
-                                   : base_particles->initializeVariable<DataType>(variables[i]);
-        for (auto child = xml_parser_.first_element_->FirstChildElement(); child; child = child->NextSiblingElement())
+        for (auto child = first_child; child; child = child->NextSiblingElement())
         {
-            xml_parser_.queryAttributeValue(child, variables[i]->Name(), data_field[index]);
+            xml_parser.queryAttributeValue(child, variables[i]->Name(), data_field[index]);
             index++;
         }
     }
 }
 //=================================================================================================//
+template <typename DataType>
+void BaseParticles::CollectAParticleVariableRecord::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           StdVec<std::pair<std::string, UnsignedInt>> &records)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        records.push_back(std::make_pair(variables[i]->Name(), UnsignedInt(sizeof(DataType))));
+    }
+}
+//=================================================================================================//
+template <typename DataType, class ExecutionPolicy>
+void BaseParticles::WriteAParticleVariableToBinary::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           const ExecutionPolicy &ex_policy, std::ostream &out_stream, UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        variables[i]->writeToBinary(ex_policy, out_stream, total_real_particles);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void BaseParticles::ReadAParticleVariableFromBinary::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           BaseParticles *base_particles, std::istream &in_stream, UnsignedInt total_real_particles)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        DataType *data_field = variables[i]->DataField() != nullptr
+                                   ? variables[i]->DataField()
+                                   : base_particles->initializeVariable<DataType>(variables[i]);
+        in_stream.read(reinterpret_cast<char *>(data_field), sizeof(DataType) * total_real_particles);
+    }
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // BASE_PARTICLES_HPP
\ No newline at end of file
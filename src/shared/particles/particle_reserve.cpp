@@ -8,6 +8,11 @@ size_t ReserveSizeFactor::operator()(BaseParticles &base_particles, Real particl
     return std::ceil(Real(base_particles.TotalRealParticles()) * size_factor_);
 }
 //=================================================================================================//
+size_t ReserveSizeFromCheckpoint::operator()(BaseParticles &base_particles, Real particle_spacing)
+{
+    return base_particles.BufferSizeFromReloadXml();
+}
+//=================================================================================================//
 void ParticleReserve::checkParticlesReserved()
 {
     if (!is_particles_reserved_)
@@ -29,6 +34,16 @@ void ParticleBuffer<Base>::checkEnoughBuffer(BaseParticles &base_particles)
     }
 }
 //=================================================================================================//
+void ParticleBuffer<Base>::checkEnoughBuffer(BaseParticles &base_particles, UnsignedInt number_of_new_particles)
+{
+    if (base_particles.TotalRealParticles() + number_of_new_particles > base_particles.RealParticlesBound())
+    {
+        std::cout << "\n ERROR: Not enough buffer particles have been reserved!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
 void ParticleBuffer<Base>::allocateBufferParticles(BaseParticles &base_particles, size_t buffer_size)
 {
     base_particles.increaseAllParticlesBounds(buffer_size);
@@ -51,6 +51,12 @@ struct ReserveSizeFactor
     size_t operator()(BaseParticles &base_particles, Real particle_spacing);
 };
 
+/** reserve the same number of buffer particles as recorded in the checkpoint the particles generated from */
+struct ReserveSizeFromCheckpoint
+{
+    size_t operator()(BaseParticles &base_particles, Real particle_spacing);
+};
+
 class ParticleReserve
 {
   public:
@@ -69,6 +75,7 @@ class ParticleBuffer<Base> : public ParticleReserve
     ParticleBuffer() : ParticleReserve(){};
     virtual ~ParticleBuffer(){};
     void checkEnoughBuffer(BaseParticles &base_particles);
+    void checkEnoughBuffer(BaseParticles &base_particles, UnsignedInt number_of_new_particles);
     void allocateBufferParticles(BaseParticles &base_particles, size_t buffer_size);
 };
 
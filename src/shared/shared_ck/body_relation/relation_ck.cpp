@@ -9,10 +9,13 @@ Relation<Base>::Relation(SPHBody &sph_body)
       offset_list_size_(particles_.RealParticlesBound() + 1) {}
 //=================================================================================================//
 Relation<Inner<>>::Relation(RealBody &real_body)
+    : Relation<Inner<>>(real_body, "") {}
+//=================================================================================================//
+Relation<Inner<>>::Relation(RealBody &real_body, const std::string &list_name)
     : Relation<Base>(real_body), real_body_(&real_body),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
-      dv_neighbor_index_(addRelationVariable<UnsignedInt>("NeighborIndex", offset_list_size_)),
-      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_)) {}
+      dv_neighbor_index_(addRelationVariable<UnsignedInt>(list_name + "NeighborIndex", offset_list_size_)),
+      dv_particle_offset_(addRelationVariable<UnsignedInt>(list_name + "ParticleOffset", offset_list_size_)) {}
 //=================================================================================================//
 void Relation<Inner<>>::registerComputingKernel(execution::Implementation<Base> *implementation)
 {
@@ -27,6 +30,9 @@ void Relation<Inner<>>::resetComputingKernelUpdated()
     }
 }
 //=================================================================================================//
+Relation<Inner<HalfList>>::Relation(RealBody &real_body)
+    : Relation<Inner<>>(real_body, "Half") {}
+//=================================================================================================//
 Relation<Contact<>>::Relation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
     : Relation<Base>(sph_body), contact_bodies_(contact_sph_bodies)
 {
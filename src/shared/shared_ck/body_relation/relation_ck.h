@@ -78,6 +78,38 @@ class Relation<Inner<>> : public Relation<Base>
     DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
     DiscreteVariable<UnsignedInt> *dv_particle_offset_;
     StdVec<execution::Implementation<Base> *> all_inner_computing_kernels_;
+
+    Relation(RealBody &real_body, const std::string &list_name);
+};
+
+/**
+ * @class Relation<Inner<HalfList>>
+ * @brief Inner relation whose neighbor list keeps a pair (i, j) only at i with j > i.
+ * It is used by kernels that add the pair contribution to both particles,
+ * so that each pair is evaluated only once.
+ */
+template <>
+class Relation<Inner<HalfList>> : public Relation<Inner<>>
+{
+  public:
+    explicit Relation(RealBody &real_body);
+    virtual ~Relation(){};
+};
+
+/** Whether an interaction is defined on a half neighbor list. */
+template <typename... Parameters>
+struct HasHalfList : std::false_type
+{
+};
+
+template <typename FirstParameter, typename... OtherParameters>
+struct HasHalfList<FirstParameter, OtherParameters...> : HasHalfList<OtherParameters...>
+{
+};
+
+template <typename... OtherParameters>
+struct HasHalfList<HalfList, OtherParameters...> : std::true_type
+{
 };
 
 template <>
@@ -49,6 +49,7 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType>
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    QuantityRecordingBuffer recording_buffer_;
 
   public:
     DataType type_indicator_; /*< this is an indicator to identify the variable type. */
@@ -60,11 +61,12 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType>
           observer_(contact_relation.getSPHBody()), plt_engine_(),
           base_particles_(observer_.getBaseParticles()),
           dynamics_identifier_name_(contact_relation.getSPHBody().getName()),
-          quantity_name_(quantity_name)
+          quantity_name_(quantity_name),
+          filefullpath_output_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat"),
+          recording_buffer_(filefullpath_output_)
     {
         DataType *interpolated_quantities = this->dv_interpolated_quantities_->DataField();
         /** Output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat";
         std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
         out_file << "run_time"
                  << "   ";
@@ -84,16 +86,19 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType>
         this->exec();
         this->dv_interpolated_quantities_->prepareForOutput(ExecutionPolicy{});
         DataType *interpolated_quantities = this->dv_interpolated_quantities_->DataField();
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
+        recording_buffer_.startRow(sv_physical_time_.getValue());
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
-            plt_engine_.writeAQuantity(out_file, interpolated_quantities[i]);
+            recording_buffer_.appendQuantity(interpolated_quantities[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        recording_buffer_.closeRow();
     };
 
+    /** the rows are appended to the .dat file every flush_interval records
+     *  or flush_time_interval seconds, whichever comes first */
+    void setFlushInterval(size_t flush_interval) { recording_buffer_.setFlushInterval(flush_interval); };
+    void setFlushTimeInterval(Real flush_time_interval) { recording_buffer_.setFlushTimeInterval(flush_time_interval); };
+
     DataType *getObservedQuantity()
     {
         return this->interpolated_quantities_;
@@ -109,6 +114,7 @@ class ReducedQuantityRecording<ExecutionPolicy, LocalReduceMethodType> : public
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    QuantityRecordingBuffer recording_buffer_;
 
   public:
     /*< deduce variable type from reduce method. */
@@ -121,10 +127,11 @@ class ReducedQuantityRecording<ExecutionPolicy, LocalReduceMethodType> : public
         : BaseIO(identifier.getSPHBody().getSPHSystem()), plt_engine_(),
           reduce_method_(identifier, std::forward<Args>(args)...),
           dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
-          quantity_name_(reduce_method_.QuantityName())
+          quantity_name_(reduce_method_.QuantityName()),
+          filefullpath_output_(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat"),
+          recording_buffer_(filefullpath_output_)
     {
         /** output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat";
         std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
         out_file << "\"run_time\""
                  << "   ";
@@ -136,12 +143,15 @@ class ReducedQuantityRecording<ExecutionPolicy, LocalReduceMethodType> : public
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
-        plt_engine_.writeAQuantity(out_file, reduce_method_.exec());
-        out_file << "\n";
-        out_file.close();
+        recording_buffer_.startRow(sv_physical_time_.getValue());
+        recording_buffer_.appendQuantity(reduce_method_.exec());
+        recording_buffer_.closeRow();
     };
+
+    /** the rows are appended to the .dat file every flush_interval records
+     *  or flush_time_interval seconds, whichever comes first */
+    void setFlushInterval(size_t flush_interval) { recording_buffer_.setFlushInterval(flush_interval); };
+    void setFlushTimeInterval(Real flush_time_interval) { recording_buffer_.setFlushTimeInterval(flush_time_interval); };
 };
 } // namespace SPH
 #endif // IO_OBSERVATION_CK_H
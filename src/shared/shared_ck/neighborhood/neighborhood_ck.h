@@ -66,6 +66,20 @@ class Neighbor<>
     Vecd *target_pos_;
 };
 
+template <>
+class Neighbor<HalfList> : public Neighbor<>
+{
+  public:
+    using Neighbor<>::Neighbor;
+    /** Flags of the particles which take pair contributions, all particles if not given.
+     *  The sleeping particles are excluded, as their accumulators are not reset. */
+    void setScatterTargets(const char *is_scatter_target) { is_scatter_target_ = is_scatter_target; };
+
+  protected:
+    const char *is_scatter_target_ = nullptr;
+    inline bool isScatterTarget(size_t i) const { return is_scatter_target_ == nullptr || is_scatter_target_[i]; };
+};
+
 class NeighborList
 {
   public:
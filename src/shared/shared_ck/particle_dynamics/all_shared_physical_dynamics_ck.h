@@ -42,6 +42,7 @@
 #include "simple_algorithms_ck.h"
 
 //soil mechanics
+#include "continuum_activity_ck.h"
 #include "continuum_integration_1st_ck.h"
 #include "continuum_integration_1st_ck.hpp"
 #include "continuum_integration_2nd_ck.h"
@@ -28,4 +28,14 @@ void QuickSort::sort(const ParallelPolicy &ex_policy, BaseParticles *particles)
     tbb::parallel_for(quick_sort_particle_range_, quick_sort_particle_body_);
 }
 //=================================================================================================//
+void RadixSort::sort(const SequencedPolicy &ex_policy, BaseParticles *particles)
+{
+    sortByBlockedPasses(ex_policy, particles->TotalRealParticles());
+}
+//=================================================================================================//
+void RadixSort::sort(const ParallelPolicy &ex_policy, BaseParticles *particles)
+{
+    sortByBlockedPasses(ex_policy, particles->TotalRealParticles());
+}
+//=================================================================================================//
 } // namespace SPH
\ No newline at end of file
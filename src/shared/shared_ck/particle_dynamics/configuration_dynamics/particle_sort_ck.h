@@ -93,6 +93,44 @@ class QuickSort
         quick_sort_particle_body_;
 };
 
+/**
+ * @class RadixSort
+ * @brief Stable least-significant-digit radix sort of the cell sequence keys.
+ * The index permutation, initialized as identity, is carried along with the keys.
+ * For host policies, each pass builds per-block digit histograms,
+ * scans them over (digit, block) and scatters the blocks independently.
+ * Passes in which all keys share the same digit are skipped.
+ * The device version, based on oneDPL, is given in the SYCL build.
+ */
+class RadixSort
+{
+    static constexpr UnsignedInt radix_bits_ = 8;
+    static constexpr UnsignedInt radix_ = 1 << radix_bits_;
+    static constexpr UnsignedInt block_size_ = 1 << 14;
+
+  public:
+    template <class ExecutionPolicy>
+    explicit RadixSort(const ExecutionPolicy &ex_policy,
+                       DiscreteVariable<UnsignedInt> *dv_sequence,
+                       DiscreteVariable<UnsignedInt> *dv_index_permutation);
+    void sort(const SequencedPolicy &ex_policy, BaseParticles *particles);
+    void sort(const ParallelPolicy &ex_policy, BaseParticles *particles);
+    void sort(const ParallelDevicePolicy &ex_policy, BaseParticles *particles);
+    /** sort the first data_size entries with a host execution policy */
+    template <class ExecutionPolicy>
+    void sortByBlockedPasses(const ExecutionPolicy &ex_policy, UnsignedInt data_size);
+    /** the number of passes not skipped in the last sort by blocked passes */
+    UnsignedInt ScatterPasses() { return scatter_passes_; };
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_sequence_;
+    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
+    StdVec<UnsignedInt> sequence_buffer_;
+    StdVec<UnsignedInt> index_permutation_buffer_;
+    StdVec<UnsignedInt> block_histograms_; /**< number of blocks x radix, digit-major */
+    UnsignedInt scatter_passes_ = 0;
+};
+
 template <class ExecutionPolicy, class SortMethodType>
 class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
 {
@@ -47,6 +47,94 @@ QuickSort::QuickSort(const ExecutionPolicy &ex_policy,
       quick_sort_particle_range_(sequence_, 0, compare_, swap_particle_index_),
       quick_sort_particle_body_() {}
 //=================================================================================================//
+template <class ExecutionPolicy>
+RadixSort::RadixSort(const ExecutionPolicy &ex_policy,
+                     DiscreteVariable<UnsignedInt> *dv_sequence,
+                     DiscreteVariable<UnsignedInt> *dv_index_permutation)
+    : dv_sequence_(dv_sequence), dv_index_permutation_(dv_index_permutation) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void RadixSort::sortByBlockedPasses(const ExecutionPolicy &ex_policy, UnsignedInt data_size)
+{
+    scatter_passes_ = 0;
+    if (data_size == 0)
+        return;
+
+    UnsignedInt block_size = block_size_;
+    UnsignedInt digit_mask = radix_ - 1;
+    UnsignedInt number_of_blocks = (data_size + block_size - 1) / block_size;
+    UnsignedInt number_of_counters = radix_ * number_of_blocks;
+    if (sequence_buffer_.size() < data_size)
+    {
+        sequence_buffer_.resize(data_size);
+        index_permutation_buffer_.resize(data_size);
+    }
+    block_histograms_.resize(number_of_counters);
+
+    UnsignedInt *sequence = dv_sequence_->DelegatedDataField(ex_policy);
+    UnsignedInt *keys = sequence;
+    UnsignedInt *values = dv_index_permutation_->DelegatedDataField(ex_policy);
+    UnsignedInt *keys_buffer = sequence_buffer_.data();
+    UnsignedInt *values_buffer = index_permutation_buffer_.data();
+    UnsignedInt *histograms = block_histograms_.data();
+
+    for (UnsignedInt shift = 0; shift < 8 * sizeof(UnsignedInt); shift += radix_bits_)
+    {
+        std::fill(histograms, histograms + number_of_counters, 0);
+        particle_for(ex_policy, IndexRange(0, number_of_blocks),
+                     [=](size_t block)
+                     {
+                         UnsignedInt end = SMIN((UnsignedInt(block) + 1) * block_size, data_size);
+                         for (UnsignedInt i = block * block_size; i != end; ++i)
+                             ++histograms[((keys[i] >> shift) & digit_mask) * number_of_blocks + block];
+                     });
+
+        // digit-major storage: the exclusive scan gives the scatter offset of each block and digit,
+        // and the pass is skipped if the counts of a digit summed over all blocks cover all data
+        bool is_single_digit = false;
+        UnsignedInt offset = 0;
+        for (UnsignedInt digit = 0; digit != radix_; ++digit)
+        {
+            UnsignedInt digit_offset = offset;
+            for (UnsignedInt k = digit * number_of_blocks; k != (digit + 1) * number_of_blocks; ++k)
+            {
+                UnsignedInt count = histograms[k];
+                histograms[k] = offset;
+                offset += count;
+            }
+            is_single_digit = is_single_digit || offset - digit_offset == data_size;
+        }
+        if (is_single_digit)
+            continue;
+        ++scatter_passes_;
+
+        particle_for(ex_policy, IndexRange(0, number_of_blocks),
+                     [=](size_t block)
+                     {
+                         UnsignedInt end = SMIN((UnsignedInt(block) + 1) * block_size, data_size);
+                         for (UnsignedInt i = block * block_size; i != end; ++i)
+                         {
+                             UnsignedInt &position = histograms[((keys[i] >> shift) & digit_mask) * number_of_blocks + block];
+                             keys_buffer[position] = keys[i];
+                             values_buffer[position] = values[i];
+                             ++position;
+                         }
+                     });
+        std::swap(keys, keys_buffer);
+        std::swap(values, values_buffer);
+    }
+
+    if (keys != sequence)
+    {
+        particle_for(ex_policy, IndexRange(0, data_size),
+                     [=](size_t i)
+                     {
+                         keys_buffer[i] = keys[i];
+                         values_buffer[i] = values[i];
+                     });
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy, class SortMethodType>
 ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_body)
     : LocalDynamics(real_body), BaseDynamics<void>(),
@@ -95,6 +183,7 @@ void ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
 template <class ExecutionPolicy, class SortMethodType>
 void ParticleSortCK<ExecutionPolicy, SortMethodType>::exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     UnsignedInt total_real_particles = particles_->TotalRealParticles();
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
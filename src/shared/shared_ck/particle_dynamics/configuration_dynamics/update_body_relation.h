@@ -62,6 +62,12 @@ class UpdateRelation<ExecutionPolicy, Inner<Parameters...>>
 
       protected:
         NeighborSearch neighbor_search_;
+
+        /** A half list keeps a pair only at the particle with the smaller index. */
+        inline bool isListedPair(UnsignedInt index_i, UnsignedInt index_j) const
+        {
+            return HasHalfList<Parameters...>::value ? index_j > index_i : index_j != index_i;
+        };
     };
     typedef UpdateRelation<ExecutionPolicy, Inner<Parameters...>> LocalDynamicsType;
     using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernel>;
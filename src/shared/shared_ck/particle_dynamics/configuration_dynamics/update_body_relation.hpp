@@ -37,7 +37,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
         index_i, this->source_pos_,
         [&](size_t index_j)
         {
-            if (index_i != index_j)
+            if (isListedPair(index_i, index_j))
             {
                 neighbor_count++;
             }
@@ -54,7 +54,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
         index_i, this->source_pos_,
         [&](size_t index_j)
         {
-            if (index_i != index_j)
+            if (isListedPair(index_i, index_j))
             {
                 this->neighbor_index_[this->particle_offset_[index_i] + neighbor_count] = index_j;
                 neighbor_count++;
@@ -65,6 +65,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
 template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
     particle_for(ex_policy_,
@@ -149,6 +150,7 @@ void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
 template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
 
     for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
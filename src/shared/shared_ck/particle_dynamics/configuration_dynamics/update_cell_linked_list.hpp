@@ -70,6 +70,7 @@ void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::ComputingKernel:
 template <class ExecutionPolicy, class CellLinkedListType>
 void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
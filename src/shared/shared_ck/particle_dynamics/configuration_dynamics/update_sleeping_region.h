@@ -0,0 +1,110 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    update_sleeping_region.h
+ * @brief   Detection of the sleeping (quiescent) region of a body.
+ * @details A cell of the cell linked list is active if at least one of its particles
+ *          satisfies the activity criterion. A particle is awake if its own cell or one of
+ *          the neighboring cells is active, so that a sleeping cell wakes up as soon as
+ *          a neighboring cell becomes active. The original ids of the awake particles are compacted
+ *          into the list "AwakeParticleIndex" which can be used by CK interaction dynamics
+ *          to skip sleeping particles, see InteractionDynamicsCK::skipSleepingParticles.
+ *          As original ids are listed, the list remains valid after particle sorting.
+ *          This dynamics should be executed after the cell linked list is updated.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef UPDATE_SLEEPING_REGION_H
+#define UPDATE_SLEEPING_REGION_H
+
+#include "base_configuration_dynamics.h"
+
+#include "all_particle_dynamics.h"
+#include "base_body.h"
+#include "base_particles.hpp"
+
+namespace SPH
+{
+template <typename... T>
+class UpdateSleepingRegion;
+
+template <class ExecutionPolicy, class ActivityCriterion>
+class UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>
+    : public LocalDynamics, public BaseDynamics<void>
+{
+    using CriterionKernel = typename ActivityCriterion::ComputingKernel;
+
+  protected:
+    ActivityCriterion activity_criterion_;
+    CellLinkedList &cell_linked_list_;
+    Mesh mesh_;
+    UnsignedInt number_of_cells_;
+    UnsignedInt awake_offset_list_size_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<UnsignedInt> *dv_original_id_;
+    DiscreteVariable<UnsignedInt> *dv_awake_particle_index_;
+    SingularVariable<UnsignedInt> *sv_total_awake_particles_;
+    DiscreteVariable<UnsignedInt> dv_cell_activity_;
+    DiscreteVariable<UnsignedInt> dv_awake_flag_;
+    DiscreteVariable<UnsignedInt> dv_awake_offset_;
+
+  public:
+    template <typename... Args>
+    UpdateSleepingRegion(RealBody &real_body, Args &&...args);
+    virtual ~UpdateSleepingRegion(){};
+
+    class ComputingKernel
+    {
+      public:
+        ComputingKernel(const ExecutionPolicy &ex_policy,
+                        UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion> &encloser);
+        void clearCellActivity(UnsignedInt cell_index);
+        void markActiveCell(UnsignedInt index_i);
+        void flagAwakeParticle(UnsignedInt index_i, UnsignedInt total_real_particles);
+        void updateAwakeParticleIndex(UnsignedInt index_i);
+
+      protected:
+        Mesh mesh_;
+        CriterionKernel is_active_;
+
+        Vecd *pos_;
+        UnsignedInt *original_id_;
+        UnsignedInt *cell_activity_;
+        UnsignedInt *awake_flag_;
+        UnsignedInt *awake_offset_;
+        UnsignedInt *awake_particle_index_;
+
+        bool isNearActiveCell(const Vecd &position);
+    };
+
+    virtual void exec(Real dt = 0.0) override;
+    typedef UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion> LocalDynamicsType;
+    using ComputingKernel = typename LocalDynamicsType::ComputingKernel;
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernel> kernel_implementation_;
+};
+
+} // namespace SPH
+#endif // UPDATE_SLEEPING_REGION_H
@@ -0,0 +1,140 @@
+#ifndef UPDATE_SLEEPING_REGION_HPP
+#define UPDATE_SLEEPING_REGION_HPP
+
+#include "update_sleeping_region.h"
+
+#include "base_particles.hpp"
+#include "mesh_iterators.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+template <typename... Args>
+UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::
+    UpdateSleepingRegion(RealBody &real_body, Args &&...args)
+    : LocalDynamics(real_body), BaseDynamics<void>(),
+      activity_criterion_(particles_, std::forward<Args>(args)...),
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      mesh_(cell_linked_list_),
+      number_of_cells_(cell_linked_list_.getCellOffsetListSize() - 1),
+      awake_offset_list_size_(particles_->ParticlesBound() + 1),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_original_id_(particles_->getVariableByName<UnsignedInt>("OriginalID")),
+      dv_awake_particle_index_(particles_->registerDiscreteVariableOnly<UnsignedInt>(
+          "AwakeParticleIndex", particles_->ParticlesBound(), [&](size_t i) -> UnsignedInt
+          { return i; })),
+      sv_total_awake_particles_(particles_->registerSingularVariable<UnsignedInt>(
+          "TotalAwakeParticles", particles_->TotalRealParticles())),
+      dv_cell_activity_(DiscreteVariable<UnsignedInt>("CellActivity", number_of_cells_)),
+      dv_awake_flag_(DiscreteVariable<UnsignedInt>("AwakeFlag", awake_offset_list_size_)),
+      dv_awake_offset_(DiscreteVariable<UnsignedInt>("AwakeOffset", awake_offset_list_size_)),
+      ex_policy_(ExecutionPolicy{}), kernel_implementation_(*this) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy,
+                    UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion> &encloser)
+    : mesh_(encloser.mesh_),
+      is_active_(ex_policy, encloser.activity_criterion_),
+      pos_(encloser.dv_pos_->DelegatedDataField(ex_policy)),
+      original_id_(encloser.dv_original_id_->DelegatedDataField(ex_policy)),
+      cell_activity_(encloser.dv_cell_activity_.DelegatedDataField(ex_policy)),
+      awake_flag_(encloser.dv_awake_flag_.DelegatedDataField(ex_policy)),
+      awake_offset_(encloser.dv_awake_offset_.DelegatedDataField(ex_policy)),
+      awake_particle_index_(encloser.dv_awake_particle_index_->DelegatedDataField(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+void UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::ComputingKernel::
+    clearCellActivity(UnsignedInt cell_index)
+{
+    cell_activity_[cell_index] = 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+void UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::ComputingKernel::
+    markActiveCell(UnsignedInt index_i)
+{
+    if (is_active_(index_i))
+    {
+        const UnsignedInt linear_index = mesh_.LinearCellIndexFromPosition(pos_[index_i]);
+        typename AtomicUnsignedIntRef<ExecutionPolicy>::type
+            atomic_cell_activity(cell_activity_[linear_index]);
+        ++atomic_cell_activity;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+bool UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::ComputingKernel::
+    isNearActiveCell(const Vecd &position)
+{
+    bool is_near_active_cell = false;
+    const Arrayi target_cell_index = mesh_.CellIndexFromPosition(position);
+    mesh_for_each(
+        Arrayi::Zero().max(target_cell_index - Arrayi::Ones()),
+        mesh_.AllCells().min(target_cell_index + 2 * Arrayi::Ones()),
+        [&](const Arrayi &cell_index)
+        {
+            is_near_active_cell = is_near_active_cell ||
+                                  cell_activity_[mesh_.LinearCellIndexFromCellIndex(cell_index)] != 0;
+        });
+    return is_near_active_cell;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+void UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::ComputingKernel::
+    flagAwakeParticle(UnsignedInt index_i, UnsignedInt total_real_particles)
+{
+    // The extra entry after the last real particle closes the list for the exclusive scan.
+    awake_flag_[index_i] =
+        index_i < total_real_particles && isNearActiveCell(pos_[index_i]) ? 1 : 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+void UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::ComputingKernel::
+    updateAwakeParticleIndex(UnsignedInt index_i)
+{
+    if (awake_flag_[index_i] != 0)
+    {
+        // original ids are listed, so that the list remains valid after particle sorting
+        awake_particle_index_[awake_offset_[index_i]] = original_id_[index_i];
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class ActivityCriterion>
+void UpdateSleepingRegion<ExecutionPolicy, ActivityCriterion>::exec(Real dt)
+{
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+
+    particle_for(ex_policy_,
+                 IndexRange(0, number_of_cells_),
+                 [=](size_t i)
+                 { computing_kernel->clearCellActivity(i); });
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->markActiveCell(i); });
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles + 1),
+                 [=](size_t i)
+                 { computing_kernel->flagAwakeParticle(i, total_real_particles); });
+
+    UnsignedInt *awake_flag = dv_awake_flag_.DelegatedDataField(ex_policy_);
+    UnsignedInt *awake_offset = dv_awake_offset_.DelegatedDataField(ex_policy_);
+    UnsignedInt total_awake_particles =
+        exclusive_scan(ex_policy_, awake_flag, awake_offset, total_real_particles + 1,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+    sv_total_awake_particles_->setValue(total_awake_particles);
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->updateAwakeParticleIndex(i); });
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // UPDATE_SLEEPING_REGION_HPP
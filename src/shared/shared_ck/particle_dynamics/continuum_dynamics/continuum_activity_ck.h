@@ -0,0 +1,98 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	continuum_activity_ck.h
+ * @brief 	Activity criterion of plastic continuum particles used for
+ *          the detection of the sleeping region, see UpdateSleepingRegion.
+ * @details A particle is active if its velocity, its deviatoric strain rate or its
+ *          unbalanced acceleration exceeds the given thresholds. The acceleration check
+ *          keeps a body at rest under body force awake until the stress is built up.
+ * @author	Shuaihao Zhang and Xiangyu Hu
+ */
+#ifndef CONTINUUM_ACTIVITY_CK_H
+#define CONTINUUM_ACTIVITY_CK_H
+
+#include "base_particles.hpp"
+
+namespace SPH
+{
+namespace continuum_dynamics
+{
+class PlasticActivityCriterion
+{
+  public:
+    PlasticActivityCriterion(BaseParticles *particles, Real velocity_threshold,
+                             Real strain_rate_threshold, Real acceleration_threshold)
+        : velocity_threshold_(velocity_threshold),
+          strain_rate_threshold_(strain_rate_threshold),
+          acceleration_threshold_(acceleration_threshold),
+          dv_mass_(particles->getVariableByName<Real>("Mass")),
+          dv_vel_(particles->registerStateVariableOnly<Vecd>("Velocity")),
+          dv_force_(particles->registerStateVariableOnly<Vecd>("Force")),
+          dv_force_prior_(particles->registerStateVariableOnly<Vecd>("ForcePrior")),
+          dv_strain_rate_3D_(particles->registerStateVariableOnly<StorageMat3d>("StrainRate3D")){};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, PlasticActivityCriterion &encloser)
+            : velocity_threshold_squared_(encloser.velocity_threshold_ * encloser.velocity_threshold_),
+              strain_rate_threshold_squared_(encloser.strain_rate_threshold_ * encloser.strain_rate_threshold_),
+              acceleration_threshold_squared_(encloser.acceleration_threshold_ * encloser.acceleration_threshold_),
+              mass_(encloser.dv_mass_->DelegatedDataField(ex_policy)),
+              vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)),
+              force_(encloser.dv_force_->DelegatedDataField(ex_policy)),
+              force_prior_(encloser.dv_force_prior_->DelegatedDataField(ex_policy)),
+              strain_rate_3D_(encloser.dv_strain_rate_3D_->DelegatedDataField(ex_policy)){};
+
+        bool operator()(UnsignedInt index_i)
+        {
+            Mat3d strain_rate = strain_rate_3D_[index_i].template cast<Real>();
+            Mat3d deviatoric_strain_rate = strain_rate - strain_rate.trace() / Real(3) * Mat3d::Identity();
+            Vecd acceleration = (force_[index_i] + force_prior_[index_i]) / mass_[index_i];
+            return vel_[index_i].squaredNorm() > velocity_threshold_squared_ ||
+                   deviatoric_strain_rate.squaredNorm() > strain_rate_threshold_squared_ ||
+                   acceleration.squaredNorm() > acceleration_threshold_squared_;
+        };
+
+      protected:
+        Real velocity_threshold_squared_;
+        Real strain_rate_threshold_squared_;
+        Real acceleration_threshold_squared_;
+        Real *mass_;
+        Vecd *vel_, *force_, *force_prior_;
+        StorageMat3d *strain_rate_3D_;
+    };
+
+  protected:
+    Real velocity_threshold_;
+    Real strain_rate_threshold_;
+    Real acceleration_threshold_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_force_, *dv_force_prior_;
+    DiscreteVariable<StorageMat3d> *dv_strain_rate_3D_;
+};
+} // namespace continuum_dynamics
+} // namespace SPH
+#endif // CONTINUUM_ACTIVITY_CK_H
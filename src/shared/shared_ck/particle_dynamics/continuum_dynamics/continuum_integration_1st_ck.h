@@ -50,8 +50,8 @@ class PlasticAcousticStep : public fluid_dynamics::AcousticStep<BaseInteractionT
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    DiscreteVariable<Mat3d> *dv_stress_tensor_3D_, *dv_strain_tensor_3D_, *dv_stress_rate_3D_, *dv_strain_rate_3D_;
-    DiscreteVariable<Matd> *dv_velocity_gradient_;
+    DiscreteVariable<StorageMat3d> *dv_stress_tensor_3D_, *dv_strain_tensor_3D_, *dv_stress_rate_3D_, *dv_strain_rate_3D_;
+    DiscreteVariable<StorageMatd> *dv_velocity_gradient_;
 
 };
 
@@ -79,7 +79,7 @@ class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
       protected:
         Real *rho_, *p_, *drho_dt_;
         Vecd *vel_, *dpos_;
-        Mat3d *stress_tensor_3D_;
+        StorageMat3d *stress_tensor_3D_;
     };
 
     class InteractKernel : public BaseInteraction::InteractKernel
@@ -96,7 +96,7 @@ class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
         Vecd *force_;
 
         //add
-        Mat3d *stress_tensor_3D_;
+        StorageMat3d *stress_tensor_3D_;
     };
 
     class UpdateKernel
@@ -143,12 +143,12 @@ class PlasticAcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrecti
         Vecd *wall_acc_ave_;
 
         //add
-        Mat3d *stress_tensor_3D_;
+        StorageMat3d *stress_tensor_3D_;
 
         //2nd
         Vecd *wall_vel_ave_, *wall_n_;
 
-        Matd *velocity_gradient_;
+        StorageMatd *velocity_gradient_;
     };
 
   protected:
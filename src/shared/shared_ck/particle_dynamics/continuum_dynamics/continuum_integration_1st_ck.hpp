@@ -14,16 +14,16 @@ template <class DynamicsIdentifier>
 PlasticAcousticStep<BaseInteractionType>::PlasticAcousticStep(DynamicsIdentifier &identifier)
     : fluid_dynamics::AcousticStep<BaseInteractionType>(identifier),
     plastic_continuum_(DynamicCast<PlasticContinuum>(this, this->sph_body_.getBaseMaterial())),
-    dv_stress_tensor_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StressTensor3D")),
-    dv_strain_tensor_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StrainTensor3D")),
-    dv_stress_rate_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StressRate3D")),
-    dv_strain_rate_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StrainRate3D")),
-    dv_velocity_gradient_(this->particles_->template registerStateVariableOnly<Matd>("VelocityGradient"))
+    dv_stress_tensor_3D_(this->particles_->template registerStateVariableOnly<StorageMat3d>("StressTensor3D")),
+    dv_strain_tensor_3D_(this->particles_->template registerStateVariableOnly<StorageMat3d>("StrainTensor3D")),
+    dv_stress_rate_3D_(this->particles_->template registerStateVariableOnly<StorageMat3d>("StressRate3D")),
+    dv_strain_rate_3D_(this->particles_->template registerStateVariableOnly<StorageMat3d>("StrainRate3D")),
+    dv_velocity_gradient_(this->particles_->template registerStateVariableOnly<StorageMatd>("VelocityGradient"))
 {
-    this->particles_->template addVariableToSort<Mat3d>("StressTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StrainTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StressRate3D");
-    this->particles_->template addVariableToSort<Mat3d>("StrainRate3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StressTensor3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StrainTensor3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StressRate3D");
+    this->particles_->template addVariableToSort<StorageMat3d>("StrainRate3D");
 }
 
 //step1-inner
@@ -54,8 +54,12 @@ void PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     InitializeKernel::initialize(size_t index_i, Real dt)
 {
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
-    p_[index_i] = -stress_tensor_3D_[index_i].trace() / 3;
+    p_[index_i] = -Real(stress_tensor_3D_[index_i].trace()) / 3;
     dpos_[index_i] += vel_[index_i] * dt * 0.5;
+    if constexpr (HasHalfList<Parameters...>::value)
+    {
+        drho_dt_[index_i] = 0.0; // accumulated from both particles of a pair
+    }
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
@@ -81,13 +85,40 @@ void PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
     Real rho_i = rho_[index_i];
-    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
+    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i].template cast<Real>());
+    if constexpr (HasHalfList<Parameters...>::value)
+    {
+        // each pair is listed once, the kernel gradient is shared and the opposite
+        // contribution is added to the neighbor directly
+        for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+        {
+            UnsignedInt index_j = this->neighbor_index_[n];
+            Real dW_ij = this->dW_ij(index_i, index_j);
+            Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j].template cast<Real>());
+            Vecd pair_force = (stress_tensor_i + stress_tensor_j) * this->e_ij(index_i, index_j) * dW_ij;
+            force += mass_[index_i] / rho_i * Vol_[index_j] * pair_force;
+            rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ij * Vol_[index_j];
+            if (this->isScatterTarget(index_j))
+            {
+                force_[index_j] -= mass_[index_j] / rho_[index_j] * Vol_[index_i] * pair_force;
+                drho_dt_[index_j] += riemann_solver_.DissipativeUJump(p_[index_j] - p_[index_i]) *
+                                     dW_ij * Vol_[index_i] * rho_[index_j];
+            }
+        }
+        if (this->isScatterTarget(index_i))
+        {
+            force_[index_i] += force;
+            drho_dt_[index_i] += rho_dissipation * rho_i;
+        }
+        return;
+    }
+
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
         Vecd nablaW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
-        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j]);
+        Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j].template cast<Real>());
         force += mass_[index_i] * rho_[index_j] * ((stress_tensor_i + stress_tensor_j) / (rho_i * rho_[index_j])) * nablaW_ijV_j;
         rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
     }
@@ -145,7 +176,7 @@ void PlasticAcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectio
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
 
-    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
+    Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i].template cast<Real>());
     
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
@@ -59,7 +59,9 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
         void initialize(size_t index_i, Real dt = 0.0);
 
       protected:
-        Vecd *vel_, *dpos_;
+        Vecd *vel_, *dpos_, *force_;
+        StorageMatd *velocity_gradient_;
+        Matd *velocity_gradient_sum_;
     };
 
     class InteractKernel : public BaseInteraction::InteractKernel
@@ -75,7 +77,8 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
         Real *Vol_, *rho_, *drho_dt_;
         Vecd *vel_, *force_;
 
-        Matd *velocity_gradient_;
+        StorageMatd *velocity_gradient_;
+        Matd *velocity_gradient_sum_;
     };
 
     class UpdateKernel
@@ -88,8 +91,9 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
       protected:
         Real *rho_, *drho_dt_;
 
-        Matd *velocity_gradient_;
-        Mat3d *stress_tensor_3D_,*strain_tensor_3D_,*stress_rate_3D_,*strain_rate_3D_;
+        StorageMatd *velocity_gradient_;
+        Matd *velocity_gradient_sum_;
+        StorageMat3d *stress_tensor_3D_,*strain_tensor_3D_,*stress_rate_3D_,*strain_rate_3D_;
 
         PlasticKernel plastic_kernel_;
     };
@@ -97,6 +101,8 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
   protected:
     KernelCorrectionType correction_;
     RiemannSolverType riemann_solver_;
+    /** velocity gradient accumulated from both particles of a pair in Real, with half list only */
+    DiscreteVariable<Matd> *dv_velocity_gradient_sum_;
 };
 
 
@@ -125,7 +131,7 @@ class PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrecti
         Real *wall_Vol_;
         Vecd *wall_vel_ave_, *wall_n_;
 
-        Matd *velocity_gradient_;
+        StorageMatd *velocity_gradient_;
     };
 
   protected:
@@ -14,7 +14,10 @@ template <class RiemannSolverType, class KernelCorrectionType, typename... Param
 PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     PlasticAcousticStep2ndHalf(Relation<Inner<Parameters...>> &inner_relation)
     : PlasticAcousticStep<Interaction<Inner<Parameters...>>>(inner_relation),
-      correction_(this->particles_), riemann_solver_(this->plastic_continuum_, this->plastic_continuum_,20.0*(Real)Dimensions)
+      correction_(this->particles_), riemann_solver_(this->plastic_continuum_, this->plastic_continuum_,20.0*(Real)Dimensions),
+      dv_velocity_gradient_sum_(HasHalfList<Parameters...>::value
+                                    ? this->particles_->template registerStateVariableOnly<Matd>("VelocityGradientSum")
+                                    : nullptr)
 {
     static_assert(std::is_base_of<KernelCorrection, KernelCorrectionType>::value,
                   "KernelCorrection is not the base of KernelCorrectionType!");
@@ -25,13 +28,25 @@ template <class ExecutionPolicy, class EncloserType>
 PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InitializeKernel::InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)),
-      dpos_(encloser.dv_dpos_->DelegatedDataField(ex_policy)) {}
+      dpos_(encloser.dv_dpos_->DelegatedDataField(ex_policy)),
+      force_(encloser.dv_force_->DelegatedDataField(ex_policy)),
+      velocity_gradient_(encloser.dv_velocity_gradient_->DelegatedDataField(ex_policy)),
+      velocity_gradient_sum_(encloser.dv_velocity_gradient_sum_ != nullptr
+                                 ? encloser.dv_velocity_gradient_sum_->DelegatedDataField(ex_policy)
+                                 : nullptr) {}
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     InitializeKernel::initialize(size_t index_i, Real dt)
 {
     dpos_[index_i] += vel_[index_i] * dt * 0.5;
+    if constexpr (HasHalfList<Parameters...>::value)
+    {
+        // accumulated from both particles of a pair
+        force_[index_i] = Vecd::Zero();
+        velocity_gradient_[index_i] = StorageMatd::Zero();
+        velocity_gradient_sum_[index_i] = Matd::Zero();
+    }
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
@@ -46,7 +61,10 @@ PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTy
       drho_dt_(encloser.dv_drho_dt_->DelegatedDataField(ex_policy)),
       vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)),
       force_(encloser.dv_force_->DelegatedDataField(ex_policy)),
-      velocity_gradient_(encloser.dv_velocity_gradient_->DelegatedDataField(ex_policy)) {}
+      velocity_gradient_(encloser.dv_velocity_gradient_->DelegatedDataField(ex_policy)),
+      velocity_gradient_sum_(encloser.dv_velocity_gradient_sum_ != nullptr
+                                 ? encloser.dv_velocity_gradient_sum_->DelegatedDataField(ex_policy)
+                                 : nullptr) {}
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
@@ -55,6 +73,43 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Real density_change_rate(0);
     Vecd p_dissipation = Vecd::Zero();
     Matd velocity_gradient = Matd::Zero();
+    if constexpr (HasHalfList<Parameters...>::value)
+    {
+        // each pair is listed once, the kernel gradient is shared and the opposite
+        // contribution is added to the neighbor directly
+        for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+        {
+            UnsignedInt index_j = this->neighbor_index_[n];
+            Vecd pair_e_ij = this->e_ij(index_i, index_j);
+            Real dW_ij = this->dW_ij(index_i, index_j);
+            Vecd vel_ij = vel_[index_i] - vel_[index_j];
+
+            Vecd e_ij = correction_(index_i) * pair_e_ij;
+            Real dW_ijV_j = dW_ij * Vol_[index_j];
+            Real u_jump = vel_ij.dot(e_ij);
+            density_change_rate += u_jump * dW_ijV_j;
+            p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * e_ij;
+            velocity_gradient -= vel_ij * dW_ijV_j * e_ij.transpose();
+
+            if (this->isScatterTarget(index_j))
+            {
+                Vecd e_ji = -(correction_(index_j) * pair_e_ij);
+                Real dW_jiV_i = dW_ij * Vol_[index_i];
+                Real u_jump_j = -vel_ij.dot(e_ji);
+                drho_dt_[index_j] += u_jump_j * dW_jiV_i * rho_[index_j];
+                force_[index_j] += riemann_solver_.DissipativePJump(u_jump_j) * dW_jiV_i * Vol_[index_j] * e_ji;
+                velocity_gradient_sum_[index_j] += vel_ij * dW_jiV_i * e_ji.transpose();
+            }
+        }
+        if (this->isScatterTarget(index_i))
+        {
+            drho_dt_[index_i] += density_change_rate * rho_[index_i];
+            force_[index_i] += p_dissipation * Vol_[index_i];
+            velocity_gradient_sum_[index_i] += velocity_gradient;
+        }
+        return;
+    }
+
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
         UnsignedInt index_j = this->neighbor_index_[n];
@@ -69,7 +124,7 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     }
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] = p_dissipation * Vol_[index_i];
-    velocity_gradient_[index_i] = velocity_gradient;
+    velocity_gradient_[index_i] = velocity_gradient.template cast<StorageReal>();
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
@@ -83,6 +138,9 @@ PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTy
       stress_rate_3D_(encloser.dv_stress_rate_3D_->DelegatedDataField(ex_policy)),
       strain_rate_3D_(encloser.dv_strain_rate_3D_->DelegatedDataField(ex_policy)),
       velocity_gradient_(encloser.dv_velocity_gradient_->DelegatedDataField(ex_policy)),
+      velocity_gradient_sum_(encloser.dv_velocity_gradient_sum_ != nullptr
+                                 ? encloser.dv_velocity_gradient_sum_->DelegatedDataField(ex_policy)
+                                 : nullptr),
       plastic_kernel_(encloser.plastic_continuum_)
       {}
 //=================================================================================================//
@@ -91,15 +149,24 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     UpdateKernel::update(size_t index_i, Real dt)
 {
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
+    if constexpr (HasHalfList<Parameters...>::value)
+    {
+        // the pair contributions are accumulated in Real and added to the contact contributions once
+        velocity_gradient_[index_i] =
+            (velocity_gradient_sum_[index_i] + velocity_gradient_[index_i].template cast<Real>()).template cast<StorageReal>();
+    }
 
-    Mat3d velocity_gradient = upgradeToMat3d(velocity_gradient_[index_i]);
-    Mat3d stress_tensor_rate_3D_ = plastic_kernel_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
-    stress_rate_3D_[index_i] = stress_tensor_rate_3D_;
-    stress_tensor_3D_[index_i] += stress_rate_3D_[index_i] * dt;
+    // the constitutive update is computed in Real and only the results are stored in StorageReal
+    Mat3d velocity_gradient = upgradeToMat3d(Matd(velocity_gradient_[index_i].template cast<Real>()));
+    Mat3d stress_tensor = stress_tensor_3D_[index_i].template cast<Real>();
+    Mat3d stress_tensor_rate_3D_ = plastic_kernel_.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    stress_rate_3D_[index_i] = stress_tensor_rate_3D_.template cast<StorageReal>();
+    stress_tensor += stress_tensor_rate_3D_ * dt;
     /*return mapping*/
-    stress_tensor_3D_[index_i] = plastic_kernel_.ReturnMapping(stress_tensor_3D_[index_i]);
-    strain_rate_3D_[index_i] = 0.5 * (velocity_gradient + velocity_gradient.transpose());
-    strain_tensor_3D_[index_i] += strain_rate_3D_[index_i] * dt;
+    stress_tensor_3D_[index_i] = plastic_kernel_.ReturnMapping(stress_tensor).template cast<StorageReal>();
+    Mat3d strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    strain_rate_3D_[index_i] = strain_rate.template cast<StorageReal>();
+    strain_tensor_3D_[index_i] += (strain_rate * dt).template cast<StorageReal>();
 }
 
 
@@ -150,7 +217,7 @@ void PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectio
     }
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] += p_dissipation * Vol_[index_i];
-    velocity_gradient_[index_i] += velocity_gradient;
+    velocity_gradient_[index_i] += velocity_gradient.template cast<StorageReal>();
 }
 } // namespace continuum_dynamics
 } // namespace SPH
@@ -32,5 +32,6 @@
 #include "force_prior_ck.hpp"
 #include "general_reduce_ck.hpp"
 #include "geometric_dynamics.hpp"
+#include "in_situ_analysis_ck.hpp"
 #include "interpolation_dynamics.hpp"
 #include "kernel_correction_ck.hpp"
@@ -0,0 +1,250 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	in_situ_analysis_ck.h
+ * @brief 	Binned histograms, cumulative distributions and spatial profiles
+ *          reduced in parallel during the run, so that they can be recorded
+ *          as a compact time series by ReducedQuantityRecording.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IN_SITU_ANALYSIS_CK_H
+#define IN_SITU_ANALYSIS_CK_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+template <int NumberOfBins>
+using BinnedData = Eigen::Matrix<Real, NumberOfBins, 1>;
+
+/**
+ * @struct BinnedSample
+ * @brief The value a particle contributes to a single bin, bin -1 for no bin.
+ * It converts to binned data with the reference value in the other bins
+ * for the iterators combining full binned data only.
+ */
+template <int NumberOfBins>
+struct BinnedSample
+{
+    int bin_;
+    Real value_;
+    Real reference_;
+    operator BinnedData<NumberOfBins>() const
+    {
+        BinnedData<NumberOfBins> binned_data = BinnedData<NumberOfBins>::Constant(reference_);
+        if (bin_ >= 0)
+            binned_data[bin_] = value_;
+        return binned_data;
+    };
+};
+
+/** The operation on the values of a single bin corresponding to that on binned data. */
+template <template <typename> class Operation>
+struct BinOperation;
+template <>
+struct BinOperation<ReduceSum>
+{
+    using type = ReduceSum<Real>;
+};
+template <>
+struct BinOperation<ReduceMaxComponents>
+{
+    using type = ReduceMax;
+};
+
+/**
+ * @struct BinnedOperation
+ * @brief Reduce operation on binned data which combines a particle sample
+ * into its bin only, so that the cost per particle does not scale with the bin number.
+ */
+template <int NumberOfBins, template <typename> class Operation>
+struct BinnedOperation : public Operation<BinnedData<NumberOfBins>>
+{
+    using Operation<BinnedData<NumberOfBins>>::operator();
+    typename BinOperation<Operation>::type bin_operation_;
+
+    void accumulate(BinnedData<NumberOfBins> &x, const BinnedSample<NumberOfBins> &y) const
+    {
+        if (y.bin_ >= 0)
+            x[y.bin_] = bin_operation_(x[y.bin_], y.value_);
+    };
+    BinnedData<NumberOfBins> operator()(BinnedData<NumberOfBins> x, const BinnedSample<NumberOfBins> &y) const
+    {
+        accumulate(x, y);
+        return x;
+    };
+};
+
+/**
+ * Reduce iterators accumulating the binned samples in place,
+ * chosen over the generic ones for the binned operations.
+ */
+template <int NumberOfBins, template <typename> class Operation, class LocalDynamicsFunction>
+inline BinnedData<NumberOfBins> particle_reduce(const SequencedPolicy &seq, const IndexRange &particles_range,
+                                                BinnedData<NumberOfBins> temp,
+                                                BinnedOperation<NumberOfBins, Operation> &operation,
+                                                const LocalDynamicsFunction &local_dynamics_function)
+{
+    for (size_t i = particles_range.begin(); i < particles_range.end(); ++i)
+    {
+        operation.accumulate(temp, local_dynamics_function(i));
+    }
+    return temp;
+}
+
+template <int NumberOfBins, template <typename> class Operation, class LocalDynamicsFunction>
+inline BinnedData<NumberOfBins> particle_reduce(const ParallelPolicy &par, const IndexRange &particles_range,
+                                                BinnedData<NumberOfBins> temp,
+                                                BinnedOperation<NumberOfBins, Operation> &operation,
+                                                const LocalDynamicsFunction &local_dynamics_function)
+{
+    return parallel_reduce(
+        particles_range, temp,
+        [&](const IndexRange &r, BinnedData<NumberOfBins> temp0) -> BinnedData<NumberOfBins>
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                operation.accumulate(temp0, local_dynamics_function(i));
+            }
+            return temp0;
+        },
+        [&](const BinnedData<NumberOfBins> &x, const BinnedData<NumberOfBins> &y) -> BinnedData<NumberOfBins>
+        {
+            return operation(x, y);
+        });
+}
+
+/**
+ * @class VariableHistogramCK
+ * @brief Histogram of a scalar variable in equal bins of [lower_bound, upper_bound],
+ * optionally weighted by another scalar variable, e.g. the volume.
+ * Values out of the range are counted in the first or the last bin.
+ */
+template <int NumberOfBins, class DynamicsIdentifier = SPHBody>
+class VariableHistogramCK
+    : public BaseLocalDynamicsReduce<BinnedOperation<NumberOfBins, ReduceSum>, DynamicsIdentifier>
+{
+  public:
+    using ReturnType = BinnedData<NumberOfBins>;
+    VariableHistogramCK(DynamicsIdentifier &identifier, const std::string &variable_name,
+                        Real lower_bound, Real upper_bound, const std::string &weight_name = "");
+    virtual ~VariableHistogramCK(){};
+    Real BinWidth() { return (upper_bound_ - lower_bound_) / Real(NumberOfBins); };
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        BinnedSample<NumberOfBins> reduce(size_t index_i, Real dt = 0.0)
+        {
+            int bin = int(std::floor((variable_[index_i] - lower_bound_) * inv_bin_width_));
+            return BinnedSample<NumberOfBins>{SMIN(SMAX(bin, 0), NumberOfBins - 1),
+                                              weight_ == nullptr ? Real(1) : weight_[index_i], Real(0)};
+        };
+
+      protected:
+        Real *variable_;
+        Real *weight_;
+        Real lower_bound_, inv_bin_width_;
+    };
+
+  protected:
+    DiscreteVariable<Real> *dv_variable_;
+    DiscreteVariable<Real> *dv_weight_;
+    Real lower_bound_, upper_bound_;
+};
+
+/**
+ * @class VariableCumulativeDistributionCK
+ * @brief The normalized cumulative distribution of a scalar variable at the upper bin bounds.
+ * Percentiles are interpolated from it within a bin width by getPercentile.
+ */
+template <int NumberOfBins, class DynamicsIdentifier = SPHBody>
+class VariableCumulativeDistributionCK : public VariableHistogramCK<NumberOfBins, DynamicsIdentifier>
+{
+  public:
+    using ReturnType = BinnedData<NumberOfBins>;
+    template <typename... Args>
+    VariableCumulativeDistributionCK(DynamicsIdentifier &identifier, const std::string &variable_name, Args &&...args);
+    virtual ~VariableCumulativeDistributionCK(){};
+    virtual ReturnType outputResult(ReturnType reduced_value) override;
+    /** the value below which the fraction, e.g. 0.95, of the samples falls */
+    Real getPercentile(const ReturnType &cumulative_distribution, Real fraction);
+};
+
+/**
+ * @class SpatialProfileCK
+ * @brief Profile of a scalar in equal bins of the particle position along an axis.
+ * The sampled scalar is a variable or a position component.
+ * With ReduceSum the values in a bin are summed, e.g. the volume per bin.
+ * With ReduceMaxComponents their maximum is taken, e.g. the deposit height
+ * when sampling the vertical position, and empty bins keep the lowest Real.
+ * Particles out of [lower_bound, upper_bound] are not counted.
+ */
+template <int NumberOfBins, template <typename> class ProfileOperation = ReduceSum,
+          class DynamicsIdentifier = SPHBody>
+class SpatialProfileCK
+    : public BaseLocalDynamicsReduce<BinnedOperation<NumberOfBins, ProfileOperation>, DynamicsIdentifier>
+{
+    using BaseReduceType = BaseLocalDynamicsReduce<BinnedOperation<NumberOfBins, ProfileOperation>, DynamicsIdentifier>;
+
+  public:
+    using ReturnType = BinnedData<NumberOfBins>;
+    SpatialProfileCK(DynamicsIdentifier &identifier, int axis, Real lower_bound, Real upper_bound,
+                     const std::string &variable_name);
+    SpatialProfileCK(DynamicsIdentifier &identifier, int axis, Real lower_bound, Real upper_bound,
+                     int sampled_axis);
+    virtual ~SpatialProfileCK(){};
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        BinnedSample<NumberOfBins> reduce(size_t index_i, Real dt = 0.0)
+        {
+            Real bin_coordinate = (pos_[index_i][axis_] - lower_bound_) * inv_bin_width_;
+            bool is_in_range = bin_coordinate >= 0.0 && bin_coordinate < Real(NumberOfBins);
+            return BinnedSample<NumberOfBins>{is_in_range ? int(bin_coordinate) : -1,
+                                              variable_ == nullptr ? pos_[index_i][sampled_axis_] : variable_[index_i],
+                                              reference_};
+        };
+
+      protected:
+        Real reference_;
+        Vecd *pos_;
+        Real *variable_;
+        int axis_, sampled_axis_;
+        Real lower_bound_, inv_bin_width_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<Real> *dv_variable_;
+    int axis_, sampled_axis_;
+    Real lower_bound_, upper_bound_;
+};
+} // namespace SPH
+#endif // IN_SITU_ANALYSIS_CK_H
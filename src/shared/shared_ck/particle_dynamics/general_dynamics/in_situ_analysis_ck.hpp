@@ -0,0 +1,99 @@
+#ifndef IN_SITU_ANALYSIS_CK_HPP
+#define IN_SITU_ANALYSIS_CK_HPP
+
+#include "in_situ_analysis_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <int NumberOfBins, class DynamicsIdentifier>
+VariableHistogramCK<NumberOfBins, DynamicsIdentifier>::
+    VariableHistogramCK(DynamicsIdentifier &identifier, const std::string &variable_name,
+                        Real lower_bound, Real upper_bound, const std::string &weight_name)
+    : BaseLocalDynamicsReduce<BinnedOperation<NumberOfBins, ReduceSum>, DynamicsIdentifier>(identifier),
+      dv_variable_(this->particles_->template getVariableByName<Real>(variable_name)),
+      dv_weight_(weight_name.empty() ? nullptr : this->particles_->template getVariableByName<Real>(weight_name)),
+      lower_bound_(lower_bound), upper_bound_(upper_bound)
+{
+    this->quantity_name_ = variable_name + "Histogram";
+}
+//=================================================================================================//
+template <int NumberOfBins, class DynamicsIdentifier>
+template <class ExecutionPolicy, class EncloserType>
+VariableHistogramCK<NumberOfBins, DynamicsIdentifier>::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : variable_(encloser.dv_variable_->DelegatedDataField(ex_policy)),
+      weight_(encloser.dv_weight_ == nullptr ? nullptr : encloser.dv_weight_->DelegatedDataField(ex_policy)),
+      lower_bound_(encloser.lower_bound_), inv_bin_width_(1.0 / encloser.BinWidth()) {}
+//=================================================================================================//
+template <int NumberOfBins, class DynamicsIdentifier>
+template <typename... Args>
+VariableCumulativeDistributionCK<NumberOfBins, DynamicsIdentifier>::
+    VariableCumulativeDistributionCK(DynamicsIdentifier &identifier, const std::string &variable_name, Args &&...args)
+    : VariableHistogramCK<NumberOfBins, DynamicsIdentifier>(identifier, variable_name, std::forward<Args>(args)...)
+{
+    this->quantity_name_ = variable_name + "CumulativeDistribution";
+}
+//=================================================================================================//
+template <int NumberOfBins, class DynamicsIdentifier>
+BinnedData<NumberOfBins> VariableCumulativeDistributionCK<NumberOfBins, DynamicsIdentifier>::
+    outputResult(ReturnType reduced_value)
+{
+    ReturnType cumulative_distribution = reduced_value;
+    for (int k = 1; k < NumberOfBins; ++k)
+    {
+        cumulative_distribution[k] += cumulative_distribution[k - 1];
+    }
+    return cumulative_distribution / (cumulative_distribution[NumberOfBins - 1] + TinyReal);
+}
+//=================================================================================================//
+template <int NumberOfBins, class DynamicsIdentifier>
+Real VariableCumulativeDistributionCK<NumberOfBins, DynamicsIdentifier>::
+    getPercentile(const ReturnType &cumulative_distribution, Real fraction)
+{
+    int bin = 0;
+    while (bin < NumberOfBins - 1 && cumulative_distribution[bin] < fraction)
+    {
+        ++bin;
+    }
+    Real lower_fraction = bin == 0 ? 0.0 : cumulative_distribution[bin - 1];
+    Real bin_fraction = (fraction - lower_fraction) / (cumulative_distribution[bin] - lower_fraction + TinyReal);
+    return this->lower_bound_ + (Real(bin) + SMIN(SMAX(bin_fraction, Real(0)), Real(1))) * this->BinWidth();
+}
+//=================================================================================================//
+template <int NumberOfBins, template <typename> class ProfileOperation, class DynamicsIdentifier>
+SpatialProfileCK<NumberOfBins, ProfileOperation, DynamicsIdentifier>::
+    SpatialProfileCK(DynamicsIdentifier &identifier, int axis, Real lower_bound, Real upper_bound,
+                     const std::string &variable_name)
+    : BaseReduceType(identifier),
+      dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
+      dv_variable_(this->particles_->template getVariableByName<Real>(variable_name)),
+      axis_(axis), sampled_axis_(axis), lower_bound_(lower_bound), upper_bound_(upper_bound)
+{
+    this->quantity_name_ = variable_name + "Profile";
+}
+//=================================================================================================//
+template <int NumberOfBins, template <typename> class ProfileOperation, class DynamicsIdentifier>
+SpatialProfileCK<NumberOfBins, ProfileOperation, DynamicsIdentifier>::
+    SpatialProfileCK(DynamicsIdentifier &identifier, int axis, Real lower_bound, Real upper_bound,
+                     int sampled_axis)
+    : BaseReduceType(identifier),
+      dv_pos_(this->particles_->template getVariableByName<Vecd>("Position")),
+      dv_variable_(nullptr), axis_(axis), sampled_axis_(sampled_axis),
+      lower_bound_(lower_bound), upper_bound_(upper_bound)
+{
+    this->quantity_name_ = "Position" + std::to_string(sampled_axis) + "Profile";
+}
+//=================================================================================================//
+template <int NumberOfBins, template <typename> class ProfileOperation, class DynamicsIdentifier>
+template <class ExecutionPolicy, class EncloserType>
+SpatialProfileCK<NumberOfBins, ProfileOperation, DynamicsIdentifier>::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : reference_(encloser.Reference()[0]),
+      pos_(encloser.dv_pos_->DelegatedDataField(ex_policy)),
+      variable_(encloser.dv_variable_ == nullptr ? nullptr : encloser.dv_variable_->DelegatedDataField(ex_policy)),
+      axis_(encloser.axis_), sampled_axis_(encloser.sampled_axis_), lower_bound_(encloser.lower_bound_),
+      inv_bin_width_(Real(NumberOfBins) / (encloser.upper_bound_ - encloser.lower_bound_)) {}
+//=================================================================================================//
+} // namespace SPH
+#endif // IN_SITU_ANALYSIS_CK_HPP
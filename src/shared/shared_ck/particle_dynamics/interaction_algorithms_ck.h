@@ -32,6 +32,7 @@
 #include "base_particle_dynamics.h"
 #include "interaction_ck.hpp"
 #include "particle_iterators.h"
+#include "tile_staging_ck.hpp"
 
 namespace SPH
 {
@@ -91,9 +92,129 @@ class InteractionDynamicsCK<OneLevel> : public InteractionDynamicsCK<Base>
     virtual void runUpdateStep(Real dt) = 0;
 };
 
+/**
+ * @class SleepingParticlesSkipping
+ * @brief Optionally restricts the particle loops of CK interaction dynamics
+ * to the awake particles listed by UpdateSleepingRegion.
+ * The list holds original ids, which are mapped to the current indices through the sorted ids,
+ * so that it remains valid when the particles are sorted between two updates of the region.
+ * Sleeping particles keep their states but are still seen as neighbors.
+ */
+template <class ExecutionPolicy>
+class SleepingParticlesSkipping
+{
+  public:
+    explicit SleepingParticlesSkipping(BaseParticles *particles)
+        : body_particles_(particles), dv_awake_particle_index_(nullptr),
+          dv_sorted_id_(nullptr), sv_total_awake_particles_(nullptr){};
+    void skipSleepingParticles();
+
+  protected:
+    BaseParticles *body_particles_;
+    DiscreteVariable<UnsignedInt> *dv_awake_particle_index_; /**< original ids of the awake particles */
+    DiscreteVariable<UnsignedInt> *dv_sorted_id_;
+    SingularVariable<UnsignedInt> *sv_total_awake_particles_;
+
+    template <class LocalDynamicsFunction>
+    void particle_for_awake(const IndexRange &loop_range, const LocalDynamicsFunction &local_dynamics_function);
+    template <class DynamicsRange, class LocalDynamicsFunction>
+    void particle_for_awake(const DynamicsRange &loop_range, const LocalDynamicsFunction &local_dynamics_function)
+    {
+        particle_for(ExecutionPolicy{}, loop_range, local_dynamics_function);
+    };
+};
+
+/**
+ * @class ColouredPairScatter
+ * @brief Runs the interaction kernels defined on a half neighbor list.
+ * Such kernels add each pair contribution to both particles.
+ * The cells of the linked list are swept in 3^d colours, so that
+ * cells run concurrently never share a neighbor particle and no atomics are required.
+ * Only the particles in the loop range are swept. When the sleeping particles are skipped,
+ * only the cells containing or next to awake particles are swept,
+ * as a sleeping particle still contributes to its pairs with awake particles.
+ * The contributions are then added to the awake particles only,
+ * as the kernels reset the accumulators of the awake particles only.
+ * Note that the cell linked list must be updated by UpdateCellLinkedList.
+ * It runs on host only, as the cell linked list is accessed by the host pointer.
+ */
+template <class ExecutionPolicy>
+class ColouredPairScatter
+{
+  public:
+    explicit ColouredPairScatter(CellLinkedList &cell_linked_list)
+        : scatter_cell_linked_list_(cell_linked_list){};
+
+  protected:
+    CellLinkedList &scatter_cell_linked_list_;
+    StdVec<char> is_awake_, is_awake_cell_, is_cell_swept_;
+
+    void markCellsNearAwakeParticles(UnsignedInt *awake_particle_index, UnsignedInt *sorted_id,
+                                     UnsignedInt total_awake_particles);
+    template <class LocalDynamicsFunction>
+    void particle_for_coloured(const IndexRange &loop_range, bool is_awake_cells_only,
+                               const LocalDynamicsFunction &local_dynamics_function);
+};
+
+/**
+ * @class CellBlockTiling
+ * @brief Optionally runs the interaction kernels tile by tile by CellBlockTiles,
+ * which is only created when the tiling is used.
+ * The data of the particles in a tile and its one-cell halo are staged
+ * into a contiguous scratch buffer of the thread, from which the tile is computed
+ * instead of gathering the neighbor data in flat particle order.
+ * Note that the cell linked list must be updated by UpdateCellLinkedList.
+ * It runs on host only, as the cell linked list is accessed by the host pointer,
+ * for the kernels which can be created with execution::TileStagedPolicy,
+ * and not together with skipping the sleeping particles.
+ */
+template <class ExecutionPolicy, class LocalDynamicsType, class KernelType>
+class CellBlockTiling
+{
+    using CellBlockTilesType = CellBlockTiles<ExecutionPolicy, LocalDynamicsType, KernelType>;
+
+  public:
+    CellBlockTiling(LocalDynamicsType &local_dynamics, BaseParticles *particles, CellLinkedList &cell_linked_list,
+                    DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                    DiscreteVariable<UnsignedInt> *dv_particle_offset)
+        : tiled_local_dynamics_(local_dynamics), tiled_particles_(particles),
+          tiled_cell_linked_list_(cell_linked_list), dv_tiled_neighbor_index_(dv_neighbor_index),
+          dv_tiled_particle_offset_(dv_particle_offset), cell_block_tiles_(nullptr){};
+    /** tile_size is the cells along each direction of a tile, 0 for flat particle order */
+    void useCellBlockTiles(UnsignedInt tile_size = 4)
+    {
+        static_assert(!std::is_base_of<execution::ParallelDevicePolicy, ExecutionPolicy>::value,
+                      "The cell block tiling is not designed for execution::ParallelDevicePolicy!");
+        static_assert(IsTileStagedKernel<KernelType, LocalDynamicsType>::value,
+                      "The cell block tiling requires a kernel created with execution::TileStagedPolicy!");
+        if (cell_block_tiles_ == nullptr)
+        {
+            cell_block_tiles_ = cell_block_tiles_keeper_.template createPtr<CellBlockTilesType>(
+                tiled_local_dynamics_, tiled_particles_, tiled_cell_linked_list_,
+                dv_tiled_neighbor_index_, dv_tiled_particle_offset_);
+        }
+        cell_block_tiles_->setTileSize(tile_size);
+    };
+
+  protected:
+    LocalDynamicsType &tiled_local_dynamics_;
+    BaseParticles *tiled_particles_;
+    CellLinkedList &tiled_cell_linked_list_;
+    DiscreteVariable<UnsignedInt> *dv_tiled_neighbor_index_;
+    DiscreteVariable<UnsignedInt> *dv_tiled_particle_offset_;
+    UniquePtrKeeper<CellBlockTilesType> cell_block_tiles_keeper_;
+    CellBlockTilesType *cell_block_tiles_; /**< nullptr if the tiling is never used */
+
+    bool isTiled() { return cell_block_tiles_ != nullptr && cell_block_tiles_->TileSize() != 0; };
+};
+
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>
-    : public InteractionType<Inner<Parameters...>>
+    : public InteractionType<Inner<Parameters...>>,
+      public SleepingParticlesSkipping<ExecutionPolicy>,
+      public ColouredPairScatter<ExecutionPolicy>,
+      public CellBlockTiling<ExecutionPolicy, InteractionType<Inner<Parameters...>>,
+                             typename InteractionType<Inner<Parameters...>>::InteractKernel>
 {
     using LocalDynamicsType = InteractionType<Inner<Parameters...>>;
     using InteractKernel = typename LocalDynamicsType::InteractKernel;
@@ -111,7 +232,8 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramet
 
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>
-    : public InteractionType<Contact<Parameters...>>
+    : public InteractionType<Contact<Parameters...>>,
+      public SleepingParticlesSkipping<ExecutionPolicy>
 {
     using LocalDynamicsType = InteractionType<Contact<Parameters...>>;
     using InteractKernel = typename LocalDynamicsType::InteractKernel;
@@ -209,6 +331,7 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<>>
   public:
     InteractionDynamicsCK(){};
     void runInteractionStep(Real dt = 0.0){};
+    void skipSleepingParticles(){};
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -224,6 +347,7 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, O
     explicit InteractionDynamicsCK(
         FirstParameterSet &&first_parameter_set, OtherParameterSets &&...other_parameter_sets);
     virtual void runInteractionStep(Real dt = 0.0) override;
+    void skipSleepingParticles();
 };
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_H
@@ -6,11 +6,129 @@
 namespace SPH
 {
 //=================================================================================================//
+template <class ExecutionPolicy>
+void SleepingParticlesSkipping<ExecutionPolicy>::skipSleepingParticles()
+{
+    dv_awake_particle_index_ = body_particles_->getVariableByName<UnsignedInt>("AwakeParticleIndex");
+    dv_sorted_id_ = body_particles_->getVariableByName<UnsignedInt>("SortedID");
+    sv_total_awake_particles_ = body_particles_->getSingularVariableByName<UnsignedInt>("TotalAwakeParticles");
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+template <class LocalDynamicsFunction>
+void SleepingParticlesSkipping<ExecutionPolicy>::
+    particle_for_awake(const IndexRange &loop_range, const LocalDynamicsFunction &local_dynamics_function)
+{
+    if (dv_awake_particle_index_ == nullptr)
+    {
+        particle_for(ExecutionPolicy{}, loop_range, local_dynamics_function);
+        return;
+    }
+
+    UnsignedInt *awake_particle_index = dv_awake_particle_index_->DelegatedDataField(ExecutionPolicy{});
+    UnsignedInt *sorted_id = dv_sorted_id_->DelegatedDataField(ExecutionPolicy{});
+    particle_for(ExecutionPolicy{},
+                 IndexRange(0, sv_total_awake_particles_->getValue()),
+                 [=](size_t n)
+                 { local_dynamics_function(sorted_id[awake_particle_index[n]]); });
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void ColouredPairScatter<ExecutionPolicy>::
+    markCellsNearAwakeParticles(UnsignedInt *awake_particle_index, UnsignedInt *sorted_id,
+                                UnsignedInt total_awake_particles)
+{
+    UnsignedInt *particle_index = scatter_cell_linked_list_.getParticleIndex()->DataField();
+    UnsignedInt *cell_offset = scatter_cell_linked_list_.getCellOffset()->DataField();
+    const Arrayi all_cells = scatter_cell_linked_list_.AllCells();
+    const UnsignedInt total_cells = all_cells.prod();
+    is_awake_.assign(cell_offset[total_cells], 0);
+    is_awake_cell_.resize(total_cells);
+    is_cell_swept_.resize(total_cells);
+    char *is_awake = is_awake_.data();
+    char *is_awake_cell = is_awake_cell_.data();
+
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_awake_particles),
+                 [&](size_t n)
+                 { is_awake[sorted_id[awake_particle_index[n]]] = 1; });
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_cells),
+                 [&](size_t l)
+                 {
+                     char has_awake_particle = 0;
+                     for (UnsignedInt n = cell_offset[l]; n < cell_offset[l + 1]; ++n)
+                     {
+                         has_awake_particle |= is_awake[particle_index[n]];
+                     }
+                     is_awake_cell[l] = has_awake_particle;
+                 });
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_cells),
+                 [&](size_t l)
+                 {
+                     const Arrayi cell_index = scatter_cell_linked_list_.transfer1DtoMeshIndex(all_cells, l);
+                     char is_near_awake_particle = 0;
+                     mesh_for_each(
+                         (cell_index - Arrayi::Ones()).max(Arrayi::Zero()),
+                         all_cells.min(cell_index + 2 * Arrayi::Ones()),
+                         [&](const Arrayi &neighbor_cell_index)
+                         {
+                             is_near_awake_particle |= is_awake_cell[scatter_cell_linked_list_.LinearCellIndexFromCellIndex(neighbor_cell_index)];
+                         });
+                     is_cell_swept_[l] = is_near_awake_particle;
+                 });
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+template <class LocalDynamicsFunction>
+void ColouredPairScatter<ExecutionPolicy>::
+    particle_for_coloured(const IndexRange &loop_range, bool is_awake_cells_only,
+                          const LocalDynamicsFunction &local_dynamics_function)
+{
+    static_assert(!std::is_base_of<execution::ParallelDevicePolicy, ExecutionPolicy>::value,
+                  "The coloured pair scatter is not designed for execution::ParallelDevicePolicy!");
+    CellLinkedList *cell_linked_list = &scatter_cell_linked_list_;
+    UnsignedInt *particle_index = scatter_cell_linked_list_.getParticleIndex()->DelegatedDataField(ExecutionPolicy{});
+    UnsignedInt *cell_offset = scatter_cell_linked_list_.getCellOffset()->DelegatedDataField(ExecutionPolicy{});
+    const char *is_cell_swept = is_awake_cells_only ? is_cell_swept_.data() : nullptr;
+    const UnsignedInt begin = loop_range.begin();
+    const UnsignedInt end = loop_range.end();
+    const Arrayi all_cells = scatter_cell_linked_list_.AllCells();
+    const Arrayi colours = 3 * Arrayi::Ones();
+    const UnsignedInt number_of_colours = colours.prod();
+
+    for (UnsignedInt k = 0; k != number_of_colours; ++k)
+    {
+        // cells of the same colour are three cells apart in each direction
+        const Arrayi colour_index = scatter_cell_linked_list_.transfer1DtoMeshIndex(colours, k);
+        const Arrayi colour_cells = (all_cells - colour_index + 2 * Arrayi::Ones()) / 3;
+        particle_for(ExecutionPolicy{},
+                     IndexRange(0, colour_cells.prod()),
+                     [=](size_t l)
+                     {
+                         const Arrayi cell_index =
+                             colour_index + 3 * cell_linked_list->transfer1DtoMeshIndex(colour_cells, l);
+                         const UnsignedInt linear_index = cell_linked_list->LinearCellIndexFromCellIndex(cell_index);
+                         if (is_cell_swept != nullptr && !is_cell_swept[linear_index])
+                             return;
+                         for (UnsignedInt n = cell_offset[linear_index]; n < cell_offset[linear_index + 1]; ++n)
+                         {
+                             const UnsignedInt index_i = particle_index[n];
+                             if (index_i >= begin && index_i < end)
+                                 local_dynamics_function(index_i);
+                         }
+                     });
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
     : InteractionType<Inner<Parameters...>>(std::forward<Args>(args)...),
+      SleepingParticlesSkipping<ExecutionPolicy>(this->particles_),
+      ColouredPairScatter<ExecutionPolicy>(this->inner_relation_.getCellLinkedList()),
+      CellBlockTiling<ExecutionPolicy, LocalDynamicsType, InteractKernel>(
+          *this, this->particles_, this->inner_relation_.getCellLinkedList(),
+          this->inner_relation_.getNeighborIndex(), this->inner_relation_.getParticleOffset()),
       kernel_implementation_(*this) {}
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
@@ -18,17 +136,52 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
     runInteraction(Real dt)
 {
     InteractKernel *interact_kernel = kernel_implementation_.getComputingKernel();
-    particle_for(ExecutionPolicy{},
-                 this->identifier_.LoopRange(),
-                 [=](size_t i)
-                 { interact_kernel->interact(i, dt); });
+    if constexpr (HasHalfList<Parameters...>::value)
+    {
+        // the sleeping particles next to awake particles are swept,
+        // as they still contribute to their pairs with awake particles
+        bool is_sleeping_skipped = this->dv_awake_particle_index_ != nullptr;
+        if (is_sleeping_skipped)
+        {
+            this->markCellsNearAwakeParticles(this->dv_awake_particle_index_->DataField(),
+                                              this->dv_sorted_id_->DataField(),
+                                              this->sv_total_awake_particles_->getValue());
+        }
+        // the sleeping particles only contribute to the awake particles
+        interact_kernel->setScatterTargets(is_sleeping_skipped ? this->is_awake_.data() : nullptr);
+        this->particle_for_coloured(this->identifier_.LoopRange(), is_sleeping_skipped,
+                                    [=](size_t i)
+                                    { interact_kernel->interact(i, dt); });
+    }
+    else
+    {
+        if constexpr (!std::is_base_of<execution::ParallelDevicePolicy, ExecutionPolicy>::value &&
+                      IsTileStagedKernel<InteractKernel, LocalDynamicsType>::value)
+        {
+            if (this->isTiled())
+            {
+                if (this->dv_awake_particle_index_ != nullptr)
+                {
+                    std::cout << "\n Error: the cell block tiling does not skip the sleeping particles!" << std::endl;
+                    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                    exit(1);
+                }
+                this->cell_block_tiles_->interact(this->identifier_.LoopRange(), dt);
+                return;
+            }
+        }
+        this->particle_for_awake(this->identifier_.LoopRange(),
+                                 [=](size_t i)
+                                 { interact_kernel->interact(i, dt); });
+    }
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
-    : InteractionType<Contact<Parameters...>>(std::forward<Args>(args)...)
+    : InteractionType<Contact<Parameters...>>(std::forward<Args>(args)...),
+      SleepingParticlesSkipping<ExecutionPolicy>(this->particles_)
 {
     for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
     {
@@ -47,10 +200,9 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parame
         InteractKernel *interact_kernel =
             contact_kernel_implementation_[k]->getComputingKernel(k);
 
-        particle_for(ExecutionPolicy{},
-                     this->identifier_.LoopRange(),
-                     [=](size_t i)
-                     { interact_kernel->interact(i, dt); });
+        this->particle_for_awake(this->identifier_.LoopRange(),
+                                 [=](size_t i)
+                                 { interact_kernel->interact(i, dt); });
     }
 }
 //=================================================================================================//
@@ -69,6 +221,7 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parameters...>>>::
     exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     this->setUpdated(this->identifier_.getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<Base>::runAllSteps(dt);
@@ -99,6 +252,7 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpdate, OtherParameters...>>>::
     exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     this->setUpdated(this->identifier_.getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<WithUpdate>::runAllSteps(dt);
@@ -118,10 +272,9 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<WithUpd
     runUpdateStep(Real dt)
 {
     UpdateKernel *update_kernel = kernel_implementation_.getComputingKernel();
-    particle_for(ExecutionPolicy{},
-                 this->identifier_.LoopRange(),
-                 [=](size_t i)
-                 { update_kernel->update(i, dt); });
+    this->particle_for_awake(this->identifier_.LoopRange(),
+                             [=](size_t i)
+                             { update_kernel->update(i, dt); });
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -139,6 +292,7 @@ template <class ExecutionPolicy, template <typename...> class InteractionType,
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
     exec(Real dt)
 {
+    DynamicsProfilingScope profiling_scope(this, this->identifier_);
     this->setUpdated(this->identifier_.getSPHBody());
     this->setupDynamics(dt);
     InteractionDynamicsCK<OneLevel>::runAllSteps(dt);
@@ -158,10 +312,9 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLeve
     runInitializationStep(Real dt)
 {
     InitializeKernel *initialize_kernel = initialize_kernel_implementation_.getComputingKernel();
-    particle_for(ExecutionPolicy{},
-                 this->identifier_.LoopRange(),
-                 [=](size_t i)
-                 { initialize_kernel->initialize(i, dt); });
+    this->particle_for_awake(this->identifier_.LoopRange(),
+                             [=](size_t i)
+                             { initialize_kernel->initialize(i, dt); });
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -170,10 +323,9 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLeve
     runUpdateStep(Real dt)
 {
     UpdateKernel *update_kernel = update_kernel_implementation_.getComputingKernel();
-    particle_for(ExecutionPolicy{},
-                 this->identifier_.LoopRange(),
-                 [=](size_t i)
-                 { update_kernel->update(i, dt); });
+    this->particle_for_awake(this->identifier_.LoopRange(),
+                             [=](size_t i)
+                             { update_kernel->update(i, dt); });
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -194,5 +346,14 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Ot
     other_interactions_.runInteractionStep(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          class FirstInteraction, class... Others>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Others...>>::
+    skipSleepingParticles()
+{
+    InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction>>::skipSleepingParticles();
+    other_interactions_.skipSleepingParticles();
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_HPP
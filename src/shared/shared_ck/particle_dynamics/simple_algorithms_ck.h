@@ -53,6 +53,7 @@ class StateDynamics : public UpdateType, public BaseDynamics<void>
 
     virtual void exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         UpdateKernel *update_kernel = kernel_implementation_.getComputingKernel();
@@ -85,12 +86,13 @@ class ReduceDynamicsCK : public ReduceType,
 
     virtual ReturnType exec(Real dt = 0.0) override
     {
+        DynamicsProfilingScope profiling_scope(this, this->identifier_);
         this->setupDynamics(dt);
         ReduceKernel *reduce_kernel = kernel_implementation_.getComputingKernel();
         ReturnType temp = particle_reduce(
             ExecutionPolicy{},
             this->identifier_.LoopRange(), this->Reference(), this->getOperation(),
-            [=](size_t i) -> ReturnType
+            [=](size_t i)
             { return reduce_kernel->reduce(i, dt); });
         return this->outputResult(temp);
     };
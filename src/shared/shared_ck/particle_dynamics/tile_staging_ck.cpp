@@ -0,0 +1,106 @@
+#include "tile_staging_ck.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+TileStaging::TileStaging(BaseParticles *particles, DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                         DiscreteVariable<UnsignedInt> *dv_particle_offset)
+    : particles_(particles), dv_neighbor_index_(dv_neighbor_index),
+      dv_particle_offset_(dv_particle_offset), tile_particles_(0),
+      staged_capacity_(0), neighbor_capacity_(0), staged_particle_offset_(1, 0) {}
+//=================================================================================================//
+void TileStaging::resetTile()
+{
+    tile_particles_ = 0;
+    staged_index_.clear();
+    halo_index_.clear();
+}
+//=================================================================================================//
+bool TileStaging::closeTile()
+{
+    tile_particles_ = staged_index_.size();
+    staged_index_.insert(staged_index_.end(), halo_index_.begin(), halo_index_.end());
+
+    UnsignedInt *particle_offset = dv_particle_offset_->DataField();
+    UnsignedInt tile_neighbors = 0;
+    for (UnsignedInt k = 0; k != tile_particles_; ++k)
+    {
+        tile_neighbors += particle_offset[staged_index_[k] + 1] - particle_offset[staged_index_[k]];
+    }
+
+    if (local_index_.size() < particles_->ParticlesBound())
+    {
+        local_index_.resize(particles_->ParticlesBound(), 0);
+    }
+
+    bool is_reallocated = false;
+    if (staged_index_.size() > staged_capacity_)
+    {
+        staged_capacity_ = 2 * staged_index_.size();
+        for (size_t k = 0; k != staged_data_fields_.size(); ++k)
+        {
+            staged_data_fields_[k]->resize(staged_capacity_);
+        }
+        staged_particle_offset_.resize(staged_capacity_ + 1);
+        is_reallocated = true;
+    }
+    if (tile_neighbors > neighbor_capacity_)
+    {
+        neighbor_capacity_ = 2 * tile_neighbors;
+        staged_neighbor_index_.resize(neighbor_capacity_);
+        is_reallocated = true;
+    }
+    return is_reallocated;
+}
+//=================================================================================================//
+void TileStaging::gather()
+{
+    for (size_t k = 0; k != kernel_data_fields_.size(); ++k)
+    {
+        kernel_data_fields_[k]->gather(staged_index_);
+    }
+    stageNeighborList();
+}
+//=================================================================================================//
+void TileStaging::stageNeighborList()
+{
+    const UnsignedInt total_staged = staged_index_.size();
+    for (UnsignedInt k = 0; k != total_staged; ++k)
+    {
+        local_index_[staged_index_[k]] = k;
+    }
+
+    UnsignedInt *neighbor_index = dv_neighbor_index_->DataField();
+    UnsignedInt *particle_offset = dv_particle_offset_->DataField();
+    UnsignedInt staged_neighbors = 0;
+    staged_particle_offset_[0] = 0;
+    for (UnsignedInt k = 0; k != tile_particles_; ++k)
+    {
+        const UnsignedInt index_i = staged_index_[k];
+        for (UnsignedInt n = particle_offset[index_i]; n != particle_offset[index_i + 1]; ++n)
+        {
+            // the local index left by an earlier tile is found invalid by the original index
+            const UnsignedInt local_j = local_index_[neighbor_index[n]];
+            if (local_j >= total_staged || staged_index_[local_j] != neighbor_index[n])
+            {
+                std::cout << "\n Error: the neighbor particle " << neighbor_index[n]
+                          << " is not within the one-cell halo of the tile!" << std::endl;
+                std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+                exit(1);
+            }
+            staged_neighbor_index_[staged_neighbors] = local_j;
+            ++staged_neighbors;
+        }
+        staged_particle_offset_[k + 1] = staged_neighbors;
+    }
+}
+//=================================================================================================//
+void TileStaging::writeBack()
+{
+    for (size_t k = 0; k != kernel_data_fields_.size(); ++k)
+    {
+        kernel_data_fields_[k]->writeBack(staged_index_, tile_particles_);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,171 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	tile_staging_ck.h
+ * @brief 	Scratch buffers and sweep for the tiled execution of the inner interactions.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef TILE_STAGING_CK_H
+#define TILE_STAGING_CK_H
+
+#include "base_particles.h"
+#include "cell_linked_list.h"
+#include "execution.h"
+#include "mesh_iterators.h"
+#include "particle_iterators.h"
+
+#include <tbb/enumerable_thread_specific.h>
+
+namespace SPH
+{
+class BaseStagedDataField
+{
+  public:
+    explicit BaseStagedDataField(Entity *variable) : variable_(variable){};
+    virtual ~BaseStagedDataField(){};
+    Entity *Variable() { return variable_; };
+    virtual void resize(UnsignedInt capacity) = 0;
+    virtual void gather(const StdVec<UnsignedInt> &staged_index) = 0;
+    virtual void writeBack(const StdVec<UnsignedInt> &staged_index, UnsignedInt tile_particles) = 0;
+
+  protected:
+    Entity *variable_;
+};
+
+template <typename DataType>
+class StagedDataField : public BaseStagedDataField
+{
+  public:
+    explicit StagedDataField(DiscreteVariable<DataType> *variable)
+        : BaseStagedDataField(variable), discrete_variable_(variable){};
+    virtual ~StagedDataField(){};
+    DataType *StagedData() { return staged_data_.data(); };
+    virtual void resize(UnsignedInt capacity) override { staged_data_.resize(capacity); };
+    virtual void gather(const StdVec<UnsignedInt> &staged_index) override;
+    /** the data of the tile particles are written back, as the kernel only writes their data */
+    virtual void writeBack(const StdVec<UnsignedInt> &staged_index, UnsignedInt tile_particles) override;
+
+  protected:
+    DiscreteVariable<DataType> *discrete_variable_;
+    StdVec<DataType> staged_data_;
+};
+
+/**
+ * @class TileStaging
+ * @brief The particles of a tile and its one-cell halo are staged in a contiguous local order,
+ * with the particles of the tile first. A computing kernel created with TileStagedPolicy
+ * accesses the staged copies of the particle variables and the neighbor list in local indices.
+ * The buffers are kept between tiles, and only reallocated when a tile exceeds their capacity,
+ * so that a kernel is created once and reused for the following tiles.
+ * After the tile is processed, the data of the tile particles are written back.
+ * Note that the kernel must access the particle data by particle variables and the neighbor list only,
+ * and only write the data of the particle it is computing for.
+ */
+class TileStaging
+{
+  public:
+    TileStaging(BaseParticles *particles, DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                DiscreteVariable<UnsignedInt> *dv_particle_offset);
+    ~TileStaging(){};
+
+    void resetTile();
+    void addTileParticle(UnsignedInt index_i) { staged_index_.push_back(index_i); };
+    void addHaloParticle(UnsignedInt index_i) { halo_index_.push_back(index_i); };
+    /** returns true if the buffers are reallocated, so that the kernel accessing them is outdated */
+    bool closeTile();
+    UnsignedInt TileParticles() { return tile_particles_; };
+    /** called before a new kernel is created, which stages its data fields again */
+    void resetKernelDataFields() { kernel_data_fields_.clear(); };
+    template <typename DataType>
+    DataType *stageDataField(DiscreteVariable<DataType> *variable);
+    void gather();
+    void writeBack();
+
+  protected:
+    BaseParticles *particles_;
+    DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
+    DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+    UnsignedInt tile_particles_;
+    UnsignedInt staged_capacity_;
+    UnsignedInt neighbor_capacity_;
+    StdVec<UnsignedInt> staged_index_; /**< original indices of the tile and then the halo particles */
+    StdVec<UnsignedInt> halo_index_;
+    StdVec<UnsignedInt> local_index_; /**< local indices of the staged particles by original index */
+    StdVec<UnsignedInt> staged_neighbor_index_;
+    StdVec<UnsignedInt> staged_particle_offset_;
+    UniquePtrsKeeper<BaseStagedDataField> staged_data_field_ptrs_;
+    StdVec<BaseStagedDataField *> staged_data_fields_;
+    StdVec<BaseStagedDataField *> kernel_data_fields_;
+    StdVec<Entity *> unstaged_variables_;
+
+    void stageNeighborList();
+};
+
+/** The kernels specialized for other execution policies can not be created on the staged data. */
+template <class KernelType, class LocalDynamicsType>
+using IsTileStagedKernel =
+    std::is_constructible<KernelType, const execution::TileStagedPolicy &, LocalDynamicsType &>;
+
+/**
+ * @class CellBlockTiles
+ * @brief Runs an inner interaction kernel tile by tile,
+ * where a tile is a block of tile_size^d cells of the cell linked list.
+ * Each thread keeps a tile staging and a kernel created with TileStagedPolicy on it.
+ * The tiles are swept in 2^d colours, so that the one-cell halo of a tile never
+ * overlaps a tile run concurrently. Therefore, the halo data staged as read-only
+ * are never written back by another thread before or during the staging.
+ * The kernel is created again when the computing kernels of the local dynamics are outdated,
+ * for example, after the neighbor list is reallocated.
+ */
+template <class ExecutionPolicy, class LocalDynamicsType, class KernelType>
+class CellBlockTiles : public execution::Implementation<Base>
+{
+    class StagedKernel
+    {
+      public:
+        StagedKernel(BaseParticles *particles, DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                     DiscreteVariable<UnsignedInt> *dv_particle_offset)
+            : tile_staging_(particles, dv_neighbor_index, dv_particle_offset), kernel_generation_(0){};
+        TileStaging tile_staging_;
+        UniquePtr<KernelType> kernel_;
+        UnsignedInt kernel_generation_;
+    };
+
+  public:
+    CellBlockTiles(LocalDynamicsType &local_dynamics, BaseParticles *particles, CellLinkedList &cell_linked_list,
+                   DiscreteVariable<UnsignedInt> *dv_neighbor_index, DiscreteVariable<UnsignedInt> *dv_particle_offset);
+    ~CellBlockTiles(){};
+    void setTileSize(UnsignedInt tile_size) { tile_size_ = tile_size; };
+    UnsignedInt TileSize() { return tile_size_; };
+    void interact(const IndexRange &loop_range, Real dt);
+
+  protected:
+    LocalDynamicsType &local_dynamics_;
+    CellLinkedList &cell_linked_list_;
+    UnsignedInt tile_size_; /**< cells along each direction of a tile */
+    UnsignedInt kernel_generation_; /**< increased when the computing kernels are outdated */
+    tbb::enumerable_thread_specific<StagedKernel> staged_kernels_;
+};
+} // namespace SPH
+#endif // TILE_STAGING_CK_H
@@ -0,0 +1,186 @@
+#ifndef TILE_STAGING_CK_HPP
+#define TILE_STAGING_CK_HPP
+
+#include "tile_staging_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename DataType>
+DataType *DiscreteVariable<DataType>::DelegatedDataField(const TileStagedPolicy &tile_staged)
+{
+    return tile_staged.tile_staging_.stageDataField(this);
+}
+//=================================================================================================//
+template <typename DataType>
+void StagedDataField<DataType>::gather(const StdVec<UnsignedInt> &staged_index)
+{
+    DataType *data_field = discrete_variable_->DataField();
+    for (size_t k = 0; k != staged_index.size(); ++k)
+    {
+        staged_data_[k] = data_field[staged_index[k]];
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void StagedDataField<DataType>::writeBack(const StdVec<UnsignedInt> &staged_index, UnsignedInt tile_particles)
+{
+    DataType *data_field = discrete_variable_->DataField();
+    for (UnsignedInt k = 0; k != tile_particles; ++k)
+    {
+        data_field[staged_index[k]] = staged_data_[k];
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+DataType *TileStaging::stageDataField(DiscreteVariable<DataType> *variable)
+{
+    if constexpr (std::is_same<DataType, UnsignedInt>::value)
+    {
+        if (variable == dv_neighbor_index_)
+            return staged_neighbor_index_.data();
+        if (variable == dv_particle_offset_)
+            return staged_particle_offset_.data();
+    }
+
+    for (size_t k = 0; k != kernel_data_fields_.size(); ++k)
+    {
+        if (kernel_data_fields_[k]->Variable() == variable)
+        {
+            return static_cast<StagedDataField<DataType> *>(kernel_data_fields_[k])->StagedData();
+        }
+    }
+
+    for (size_t k = 0; k != unstaged_variables_.size(); ++k)
+    {
+        if (unstaged_variables_[k] == variable)
+        {
+            return variable->DataField();
+        }
+    }
+
+    StagedDataField<DataType> *staged_data_field = nullptr;
+    for (size_t k = 0; k != staged_data_fields_.size(); ++k)
+    {
+        if (staged_data_fields_[k]->Variable() == variable)
+        {
+            staged_data_field = static_cast<StagedDataField<DataType> *>(staged_data_fields_[k]);
+        }
+    }
+
+    if (staged_data_field == nullptr)
+    {
+        // the data not indexed by particles, such as those of meshes, are not staged
+        if (findVariableByName<DataType>(particles_->AllDiscreteVariables(), variable->Name()) != variable)
+        {
+            unstaged_variables_.push_back(variable);
+            return variable->DataField();
+        }
+        staged_data_field = staged_data_field_ptrs_.createPtr<StagedDataField<DataType>>(variable);
+        staged_data_field->resize(staged_capacity_);
+        staged_data_fields_.push_back(staged_data_field);
+    }
+    kernel_data_fields_.push_back(staged_data_field);
+    return staged_data_field->StagedData();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class LocalDynamicsType, class KernelType>
+CellBlockTiles<ExecutionPolicy, LocalDynamicsType, KernelType>::
+    CellBlockTiles(LocalDynamicsType &local_dynamics, BaseParticles *particles, CellLinkedList &cell_linked_list,
+                   DiscreteVariable<UnsignedInt> *dv_neighbor_index, DiscreteVariable<UnsignedInt> *dv_particle_offset)
+    : execution::Implementation<Base>(), local_dynamics_(local_dynamics),
+      cell_linked_list_(cell_linked_list), tile_size_(1), kernel_generation_(0),
+      staged_kernels_(particles, dv_neighbor_index, dv_particle_offset)
+{
+    local_dynamics_.registerComputingKernel(this);
+    setUpdated();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class LocalDynamicsType, class KernelType>
+void CellBlockTiles<ExecutionPolicy, LocalDynamicsType, KernelType>::
+    interact(const IndexRange &loop_range, Real dt)
+{
+    if (!isUpdated())
+    {
+        ++kernel_generation_;
+        setUpdated();
+    }
+
+    LocalDynamicsType *local_dynamics = &local_dynamics_;
+    CellLinkedList *cell_linked_list = &cell_linked_list_;
+    tbb::enumerable_thread_specific<StagedKernel> *staged_kernels = &staged_kernels_;
+    UnsignedInt *particle_index = cell_linked_list_.getParticleIndex()->DataField();
+    UnsignedInt *cell_offset = cell_linked_list_.getCellOffset()->DataField();
+    const UnsignedInt begin = loop_range.begin();
+    const UnsignedInt end = loop_range.end();
+    const UnsignedInt kernel_generation = kernel_generation_;
+    const Arrayi all_cells = cell_linked_list_.AllCells();
+    const int tile_size = tile_size_;
+    const Arrayi all_tiles = (all_cells + (tile_size - 1) * Arrayi::Ones()) / tile_size;
+    const Arrayi colours = 2 * Arrayi::Ones();
+    const UnsignedInt number_of_colours = colours.prod();
+
+    for (UnsignedInt k = 0; k != number_of_colours; ++k)
+    {
+        // tiles of the same colour are one tile apart in each direction
+        const Arrayi colour_index = cell_linked_list_.transfer1DtoMeshIndex(colours, k);
+        const Arrayi colour_tiles = (all_tiles - colour_index + Arrayi::Ones()) / 2;
+        particle_for(ExecutionPolicy{},
+                     IndexRange(0, colour_tiles.prod()),
+                     [=](size_t l)
+                     {
+                         StagedKernel &staged_kernel = staged_kernels->local();
+                         TileStaging &tile_staging = staged_kernel.tile_staging_;
+                         tile_staging.resetTile();
+                         const Arrayi tile_index = colour_index + 2 * cell_linked_list->transfer1DtoMeshIndex(colour_tiles, l);
+                         const Arrayi lower = tile_size * tile_index;
+                         const Arrayi upper = all_cells.min(lower + tile_size * Arrayi::Ones());
+                         mesh_for_each(
+                             lower, upper,
+                             [&](const Arrayi &cell_index)
+                             {
+                                 const UnsignedInt linear_index = cell_linked_list->LinearCellIndexFromCellIndex(cell_index);
+                                 for (UnsignedInt n = cell_offset[linear_index]; n < cell_offset[linear_index + 1]; ++n)
+                                 {
+                                     const UnsignedInt index_i = particle_index[n];
+                                     index_i >= begin && index_i < end
+                                         ? tile_staging.addTileParticle(index_i)
+                                         : tile_staging.addHaloParticle(index_i);
+                                 }
+                             });
+                         mesh_for_each(
+                             (lower - Arrayi::Ones()).max(Arrayi::Zero()), all_cells.min(upper + Arrayi::Ones()),
+                             [&](const Arrayi &cell_index)
+                             {
+                                 if ((cell_index >= lower).all() && (cell_index < upper).all())
+                                     return;
+                                 const UnsignedInt linear_index = cell_linked_list->LinearCellIndexFromCellIndex(cell_index);
+                                 for (UnsignedInt n = cell_offset[linear_index]; n < cell_offset[linear_index + 1]; ++n)
+                                 {
+                                     tile_staging.addHaloParticle(particle_index[n]);
+                                 }
+                             });
+                         const bool is_reallocated = tile_staging.closeTile();
+                         if (tile_staging.TileParticles() == 0)
+                             return;
+
+                         if (staged_kernel.kernel_ == nullptr || is_reallocated ||
+                             staged_kernel.kernel_generation_ != kernel_generation)
+                         {
+                             tile_staging.resetKernelDataFields();
+                             staged_kernel.kernel_ = makeUnique<KernelType>(execution::TileStagedPolicy(tile_staging), *local_dynamics);
+                             staged_kernel.kernel_generation_ = kernel_generation;
+                         }
+                         tile_staging.gather();
+                         KernelType *kernel = staged_kernel.kernel_.get();
+                         for (UnsignedInt i = 0; i != tile_staging.TileParticles(); ++i)
+                         {
+                             kernel->interact(i, dt);
+                         }
+                         tile_staging.writeBack();
+                     });
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // TILE_STAGING_CK_HPP
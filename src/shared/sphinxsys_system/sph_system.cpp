@@ -17,6 +17,12 @@ SPHSystem::SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref, size
     registerSystemVariable<Real>("PhysicalTime", 0.0);
 }
 //=================================================================================================//
+SPHSystem::~SPHSystem()
+{
+    if (trace_recorder.isActive())
+        trace_recorder.writeTraceFile();
+}
+//=================================================================================================//
 IOEnvironment &SPHSystem::getIOEnvironment()
 {
     if (io_environment_ == nullptr)
@@ -31,6 +37,7 @@ IOEnvironment &SPHSystem::getIOEnvironment()
 
 void SPHSystem::initializeSystemCellLinkedLists()
 {
+    TraceScope trace_scope("SPHSystem::initializeSystemCellLinkedLists");
     for (auto &body : real_bodies_)
     {
         DynamicCast<RealBody>(this, body)->updateCellLinkedList();
@@ -39,6 +46,7 @@ void SPHSystem::initializeSystemCellLinkedLists()
 //=================================================================================================//
 void SPHSystem::initializeSystemConfigurations()
 {
+    TraceScope trace_scope("SPHSystem::initializeSystemConfigurations");
     for (auto &body : sph_bodies_)
     {
         for (size_t i = 0; i < body->body_relations_.size(); i++)
@@ -74,6 +82,9 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
+        desc.add_options()("profiling", po::value<bool>(), "Profiling of the execution of dynamics.");
+        desc.add_options()("tracing", po::value<bool>(), "Timeline tracing in Chrome trace-event format.");
+        desc.add_options()("numa_affinity", po::value<bool>(), "Socket-affine partitioning of particle loops.");
 
         po::variables_map vm;
         po::store(po::parse_command_line(ac, av, desc), vm);
@@ -144,6 +155,27 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
             std::cout << "Restart inactivated, i.e. restart_step ("
                       << restart_step_ << ").\n";
         }
+
+        if (vm.count("profiling"))
+        {
+            setProfiling(vm["profiling"].as<bool>());
+            std::cout << "Profiling was set to "
+                      << vm["profiling"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("tracing"))
+        {
+            setTracing(vm["tracing"].as<bool>());
+            std::cout << "Tracing was set to "
+                      << vm["tracing"].as<bool>() << ".\n";
+        }
+
+        if (vm.count("numa_affinity"))
+        {
+            setNumaAffinity(vm["numa_affinity"].as<bool>());
+            std::cout << "NUMA affinity was set to "
+                      << NumaAffinity() << ".\n";
+        }
     }
     catch (std::exception &e)
     {
@@ -162,6 +194,8 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
 SPHSystem *SPHSystem::setIOEnvironment(bool delete_output)
 {
     io_environment_ = io_ptr_keeper_.createPtr<IOEnvironment>(*this, delete_output);
+    dynamics_profiler.setOutputFolder(io_environment_->output_folder_);
+    trace_recorder.setOutputFolder(io_environment_->output_folder_);
     return this;
 }
 //=================================================================================================//
@@ -38,6 +38,8 @@ namespace po = boost::program_options;
 #endif
 
 #include "base_data_package.h"
+#include "dynamics_profiler.h"
+#include "numa_partitioner.h"
 #include "execution_policy.h"
 #include "io_environment.h"
 #include "sphinxsys_containers.h"
@@ -73,7 +75,7 @@ class SPHSystem
 
     SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref,
               size_t number_of_threads = std::thread::hardware_concurrency());
-    virtual ~SPHSystem(){};
+    virtual ~SPHSystem();
 
 #ifdef BOOST_AVAILABLE
     SPHSystem *handleCommandlineOptions(int ac, char *av[]);
@@ -88,6 +90,17 @@ class SPHSystem
     void setGenerateRegressionData(bool generate_regression_data) { generate_regression_data_ = generate_regression_data; };
     bool StateRecording() { return state_recording_; };
     void setStateRecording(bool state_recording) { state_recording_ = state_recording; };
+    /** Profiling of the execution of dynamics, see DynamicsProfiler. */
+    bool Profiling() { return dynamics_profiler.isActive(); };
+    void setProfiling(bool profiling) { dynamics_profiler.setActive(profiling); };
+    /** Timeline tracing exported as Chrome trace-event JSON at the destruction of the system, see TraceRecorder. */
+    bool Tracing() { return trace_recorder.isActive(); };
+    void setTracing(bool tracing) { trace_recorder.setActive(tracing); };
+    /** Socket-affine partitioning of particle loops, see NumaPartitioner.
+     *  It should be set before the particles are generated,
+     *  and the functions initializing particle variables have to be thread safe then. */
+    bool NumaAffinity() { return numa_partitioner.isActive(); };
+    void setNumaAffinity(bool numa_affinity) { numa_partitioner.setActive(numa_affinity); };
     void setRestartStep(size_t restart_step) { restart_step_ = restart_step; };
     size_t RestartStep() { return restart_step_; };
     /** Initialize cell linked list for the SPH system. */
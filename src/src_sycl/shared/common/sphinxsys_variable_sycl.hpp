@@ -15,6 +15,8 @@ DeviceSharedSingularVariable<DataType>::
 {
     *device_shared_value_ = *host_variable->ValueAddress();
     host_variable->setDelegateValueAddress(device_shared_value_);
+    host_variable->setDeviceSynchronizer([]()
+                                         { execution::execution_instance.synchronize(); });
 }
 //=================================================================================================//
 template <typename DataType>
@@ -42,6 +44,29 @@ void DiscreteVariable<DataType>::synchronizeToDevice()
 }
 //=================================================================================================//
 template <typename DataType>
+void DiscreteVariable<DataType>::stageForOutput(const ParallelDevicePolicy &ex_policy)
+{
+    if (existDeviceDataField())
+    {
+        execution::execution_instance.stageCopyFromDevice(data_field_, device_data_field_, data_size_ * sizeof(DataType));
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void DiscreteVariable<DataType>::
+    writeToBinary(const ParallelDevicePolicy &ex_policy, std::ostream &out_stream, size_t data_size)
+{
+    // the host data are staged too, so that the writes keep their order in the stream
+    execution::execution_instance.stageWriteFromDevice(
+        out_stream, existDeviceDataField() ? device_data_field_ : data_field_, data_size * sizeof(DataType));
+}
+//=================================================================================================//
+inline void copyStagedOutputFromDevice(const ParallelDevicePolicy &ex_policy)
+{
+    execution::execution_instance.copyStagedFromDevice();
+}
+//=================================================================================================//
+template <typename DataType>
 DeviceOnlyDiscreteVariable<DataType>::
     DeviceOnlyDiscreteVariable(DiscreteVariable<DataType> *host_variable)
     : Entity(host_variable->Name()), device_only_data_field_(nullptr)
@@ -31,7 +31,6 @@
 #include "base_configuration_dynamics_sycl.h"
 #include "particle_iterators_sycl.h"
 #include "particle_sort_sycl.h"
-#include "particle_sort_sycl.hpp"
 #include "sphinxsys_ck.h"
 #include "sphinxsys_constant_sycl.hpp"
 #include "sphinxsys_variable_sycl.hpp"
@@ -11,6 +11,8 @@ void RadixSort::sort(const ParallelDevicePolicy &ex_policy, BaseParticles *parti
     UnsignedInt *index_permutation = dv_index_permutation_->DelegatedDataField(ex_policy);
     UnsignedInt *sequence = dv_sequence_->DelegatedDataField(ex_policy);
     UnsignedInt total_real_particles = particles->TotalRealParticles();
+    // the sort is not chained by events, the sequence must be completed before
+    execution_instance.synchronize();
     oneapi::dpl::sort_by_key(oneapi::dpl::execution::make_device_policy(execution_instance.getQueue()),
                              sequence, sequence + total_real_particles, index_permutation);
 }
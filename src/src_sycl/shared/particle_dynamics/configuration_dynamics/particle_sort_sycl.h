@@ -36,19 +36,6 @@
 namespace SPH
 {
 using namespace execution;
-
-class RadixSort
-{
-  public:
-    template <class ExecutionPolicy>
-    explicit RadixSort(const ExecutionPolicy &ex_policy,
-                       DiscreteVariable<UnsignedInt> *dv_sequence,
-                       DiscreteVariable<UnsignedInt> *dv_index_permutation);
-    void sort(const ParallelDevicePolicy &ex_policy, BaseParticles *particles);
-
-  protected:
-    DiscreteVariable<UnsignedInt> *dv_sequence_;
-    DiscreteVariable<UnsignedInt> *dv_index_permutation_;
-};
+// RadixSort is declared in particle_sort_ck.h, its device sort is given in particle_sort_sycl.cpp.
 } // namespace SPH
 #endif // PARTICLE_SORT_SYCL_H
@@ -34,7 +34,10 @@
 #include "execution_policy.h"
 
 #include "ownership.h"
+#include <cstring>
+#include <ostream>
 #include <sycl/sycl.hpp>
+#include <vector>
 
 namespace SPH
 {
@@ -69,6 +72,122 @@ class ExecutionInstance
         work_group_size_ = work_group_size;
     }
 
+    /** In asynchronous mode, kernels are submitted without waiting and chained in order by events.
+     *  The host synchronizes only where a host value or host memory is needed, i.e.
+     *  reductions, scans, memory transfers and deallocation, or explicitly by synchronize().
+     *  The host access to device-shared singular variables, e.g. the physical time,
+     *  synchronizes as well, see SingularVariable::setValue. */
+    bool isAsynchronous() const { return is_asynchronous_; };
+    void setAsynchronous(bool is_asynchronous)
+    {
+        synchronize();
+        is_asynchronous_ = is_asynchronous;
+    };
+
+    /** Submits a command group depending on the previous submission. */
+    template <class CommandGroupFunction>
+    sycl::event submit(const CommandGroupFunction &command_group_function)
+    {
+        last_event_ = getQueue().submit(
+            [&](sycl::handler &cgh)
+            {
+                cgh.depends_on(last_event_);
+                command_group_function(cgh);
+            });
+        if (!is_asynchronous_)
+            synchronize();
+        return last_event_;
+    };
+
+    /** Waits for all submitted work and rethrows asynchronous errors. */
+    void synchronize()
+    {
+        last_event_.wait_and_throw();
+        last_event_ = sycl::event();
+    };
+
+    /** Device memory reused by algorithms needing temporary storage, e.g. the block scan.
+     *  The content is not preserved when a larger size is requested. */
+    template <typename T>
+    T *getScratchMemory(size_t size)
+    {
+        size_t required_bytes = size * sizeof(T);
+        if (scratch_memory_bytes_ < required_bytes)
+        {
+            synchronize();
+            if (scratch_memory_ != nullptr)
+                sycl::free(scratch_memory_, getQueue());
+            scratch_memory_bytes_ = required_bytes + required_bytes / 4;
+            scratch_memory_ = sycl::malloc_device(scratch_memory_bytes_, getQueue());
+        }
+        return static_cast<T *>(scratch_memory_);
+    };
+
+    /** Device-to-host copies for output are staged, i.e. only recorded here,
+     *  and then submitted together and waited for only once by copyStagedFromDevice,
+     *  instead of one blocking transfer for each variable. */
+    void stageCopyFromDevice(void *host, const void *device, size_t bytes)
+    {
+        staged_copies_.push_back({host, nullptr, device, bytes});
+    };
+
+    /** As stageCopyFromDevice, but the data are copied into a pinned host buffer
+     *  and written from there to the binary output stream, in the staged order. */
+    void stageWriteFromDevice(std::ostream &out_stream, const void *device, size_t bytes)
+    {
+        staged_copies_.push_back({nullptr, &out_stream, device, bytes});
+    };
+
+    void copyStagedFromDevice()
+    {
+        if (staged_copies_.empty())
+            return;
+
+        size_t required_bytes = 0;
+        for (const StagedCopy &staged_copy : staged_copies_)
+        {
+            if (staged_copy.out_stream_ != nullptr)
+                required_bytes += alignedStagingBytes(staged_copy.bytes_);
+        }
+
+        synchronize();
+        if (host_staging_memory_bytes_ < required_bytes)
+        {
+            if (host_staging_memory_ != nullptr)
+                sycl::free(host_staging_memory_, getQueue());
+            host_staging_memory_bytes_ = required_bytes + required_bytes / 4;
+            host_staging_memory_ = static_cast<char *>(sycl::malloc_host(host_staging_memory_bytes_, getQueue()));
+        }
+
+        // the copies are independent of each other and are waited for only once
+        std::vector<sycl::event> copy_events;
+        copy_events.reserve(staged_copies_.size());
+        size_t offset = 0;
+        for (const StagedCopy &staged_copy : staged_copies_)
+        {
+            if (staged_copy.out_stream_ == nullptr)
+            {
+                copy_events.push_back(getQueue().memcpy(staged_copy.host_, staged_copy.device_, staged_copy.bytes_));
+                continue;
+            }
+            copy_events.push_back(
+                getQueue().memcpy(host_staging_memory_ + offset, staged_copy.device_, staged_copy.bytes_));
+            offset += alignedStagingBytes(staged_copy.bytes_);
+        }
+        sycl::event::wait_and_throw(copy_events);
+
+        offset = 0;
+        for (const StagedCopy &staged_copy : staged_copies_)
+        {
+            if (staged_copy.out_stream_ != nullptr)
+            {
+                staged_copy.out_stream_->write(host_staging_memory_ + offset, staged_copy.bytes_);
+                offset += alignedStagingBytes(staged_copy.bytes_);
+            }
+        }
+        staged_copies_.clear();
+    };
+
     static inline sycl::nd_range<1> getUniformNdRange(size_t global_size, size_t local_size)
     {
         return {global_size % local_size ? (global_size / local_size + 1) * local_size : global_size, local_size};
@@ -80,11 +199,45 @@ class ExecutionInstance
         return getUniformNdRange(global_size, work_group_size_);
     }
 
+    ~ExecutionInstance()
+    {
+        if (scratch_memory_ != nullptr)
+        {
+            synchronize();
+            sycl::free(scratch_memory_, *sycl_queue_);
+        }
+        if (host_staging_memory_ != nullptr)
+        {
+            synchronize();
+            sycl::free(host_staging_memory_, *sycl_queue_);
+        }
+    };
+
   private:
-    ExecutionInstance() : work_group_size_(128), sycl_queue_() {}
+    ExecutionInstance()
+        : work_group_size_(128), sycl_queue_(), is_asynchronous_(false), last_event_(),
+          scratch_memory_(nullptr), scratch_memory_bytes_(0),
+          host_staging_memory_(nullptr), host_staging_memory_bytes_(0) {}
+
+    struct StagedCopy
+    {
+        void *host_;
+        std::ostream *out_stream_;
+        const void *device_;
+        size_t bytes_;
+    };
+
+    static size_t alignedStagingBytes(size_t bytes) { return (bytes + 63) / 64 * 64; };
 
     size_t work_group_size_;
     UniquePtr<sycl::queue> sycl_queue_;
+    bool is_asynchronous_;
+    sycl::event last_event_; /**< the last submission, a default event is complete */
+    void *scratch_memory_;
+    size_t scratch_memory_bytes_;
+    std::vector<StagedCopy> staged_copies_;
+    char *host_staging_memory_; /**< pinned host memory for the staged writes from device */
+    size_t host_staging_memory_bytes_;
 
 } static &execution_instance = ExecutionInstance::getInstance();
 
@@ -106,24 +259,28 @@ inline T *allocateDeviceShared(std::size_t size)
 template <class T>
 inline void freeDeviceData(T *device_mem)
 {
+    execution::execution_instance.synchronize();
     sycl::free(device_mem, execution::execution_instance.getQueue());
 }
 
 template <class T>
 inline void copyToDevice(const T *host, T *device, std::size_t size)
 {
+    execution::execution_instance.synchronize();
     execution::execution_instance.getQueue().memcpy(device, host, size * sizeof(T)).wait_and_throw();
 }
 
 template <class T>
 inline void copyToDevice(const T &value, T *device, std::size_t size)
 {
+    execution::execution_instance.synchronize();
     execution::execution_instance.getQueue().fill(device, value, size).wait_and_throw();
 }
 
 template <class T>
 inline void copyFromDevice(T *host, const T *device, std::size_t size)
 {
+    execution::execution_instance.synchronize();
     execution::execution_instance.getQueue().memcpy(host, device, size * sizeof(T)).wait_and_throw();
 }
 
@@ -38,14 +38,12 @@ template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelDevicePolicy &par_device,
                          const IndexRange &particles_range, const LocalDynamicsFunction &local_dynamics_function)
 {
-    auto &sycl_queue = execution_instance.getQueue();
     const size_t particles_size = particles_range.size();
-    sycl_queue.submit([&](sycl::handler &cgh)
-                      { cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), [=](sycl::nd_item<1> index)
-                                         {
+    execution_instance.submit([&](sycl::handler &cgh)
+                              { cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), [=](sycl::nd_item<1> index)
+                                                 {
                                  if(index.get_global_id(0) < particles_size)
-                                     local_dynamics_function(index.get_global_id(0)); }); })
-        .wait_and_throw();
+                                     local_dynamics_function(index.get_global_id(0)); }); });
 }
 
 template <class ReturnType, typename Operation, class LocalDynamicsFunction>
@@ -53,39 +51,75 @@ inline ReturnType particle_reduce(const ParallelDevicePolicy &par_device,
                                   const IndexRange &particles_range, ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
-    auto &sycl_queue = execution_instance.getQueue();
     const size_t particles_size = particles_range.size();
     {
         sycl::buffer<ReturnType> buffer_result(&temp, 1);
-        sycl_queue.submit([&](sycl::handler &cgh)
+        execution_instance.submit([&](sycl::handler &cgh)
                           {
                               auto reduction_operator = sycl::reduction(buffer_result, cgh, operation);
                               cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), reduction_operator,
                                                [=](sycl::nd_item<1> item, auto& reduction) {
                                                    if(item.get_global_id() < particles_size)
                                                        reduction.combine(local_dynamics_function(item.get_global_id(0)));
-                                               }); })
-            .wait_and_throw();
+                                               }); });
+        execution_instance.synchronize(); // the result is needed on host
     } // buffer_result goes out of scope, so the result (of temp) is updated
     return temp;
 }
 
+/**
+ * Three-phase block scan using all work groups of the device:
+ * each work group reduces a block of the input, the block sums are scanned by one work group,
+ * and each work group scans its block starting from the scanned sum of the preceding blocks.
+ * The returned value is the last element of the scanned output.
+ */
 template <typename T, typename Op>
 T exclusive_scan(const ParallelDevicePolicy &par_policy, T *first, T *d_first, UnsignedInt d_size, Op op)
 {
-    execution_instance.getQueue()
-        .submit([=](sycl::handler &cgh)
-                { cgh.parallel_for(
-                      execution_instance.getUniformNdRange(execution_instance.getWorkGroupSize()),
-                      [=](sycl::nd_item<1> item)
-                      {
-                          if (item.get_group_linear_id() == 0)
-                          {
-                              sycl::joint_exclusive_scan(
-                                  item.get_group(), first, first + d_size, d_first, T{0}, op);
-                          }
-                      }); })
-        .wait_and_throw();
+    constexpr UnsignedInt items_per_work_item = 8;
+    const UnsignedInt work_group_size = execution_instance.getWorkGroupSize();
+    const UnsignedInt block_size = work_group_size * items_per_work_item;
+    const UnsignedInt number_of_blocks = (d_size + block_size - 1) / block_size;
+    T *block_sums = execution_instance.getScratchMemory<T>(2 * number_of_blocks);
+    T *block_offsets = block_sums + number_of_blocks;
+    const sycl::nd_range<1> block_nd_range(number_of_blocks * work_group_size, work_group_size);
+
+    execution_instance.submit([=](sycl::handler &cgh)
+                              { cgh.parallel_for(
+                                    block_nd_range,
+                                    [=](sycl::nd_item<1> item)
+                                    {
+                                        const UnsignedInt block = item.get_group_linear_id();
+                                        const UnsignedInt block_begin = block * block_size;
+                                        const UnsignedInt block_end = sycl::min(block_begin + block_size, d_size);
+                                        T block_sum = sycl::joint_reduce(
+                                            item.get_group(), first + block_begin, first + block_end, T{0}, op);
+                                        if (item.get_local_linear_id() == 0)
+                                            block_sums[block] = block_sum;
+                                    }); });
+
+    execution_instance.submit([=](sycl::handler &cgh)
+                              { cgh.parallel_for(
+                                    execution_instance.getUniformNdRange(work_group_size),
+                                    [=](sycl::nd_item<1> item)
+                                    {
+                                        sycl::joint_exclusive_scan(
+                                            item.get_group(), block_sums, block_sums + number_of_blocks,
+                                            block_offsets, T{0}, op);
+                                    }); });
+
+    execution_instance.submit([=](sycl::handler &cgh)
+                              { cgh.parallel_for(
+                                    block_nd_range,
+                                    [=](sycl::nd_item<1> item)
+                                    {
+                                        const UnsignedInt block = item.get_group_linear_id();
+                                        const UnsignedInt block_begin = block * block_size;
+                                        const UnsignedInt block_end = sycl::min(block_begin + block_size, d_size);
+                                        sycl::joint_exclusive_scan(
+                                            item.get_group(), first + block_begin, first + block_end,
+                                            d_first + block_begin, block_offsets[block], op);
+                                    }); });
 
     UnsignedInt scan_size = d_size - 1;
     T last_value;
@@ -111,10 +111,8 @@ int main(int ac, char *av[])
     BodyStatesRecordingToVtp body_states_recording(sph_system);
     body_states_recording.addToWrite<Real>(soil_block, "Pressure");
     body_states_recording.addToWrite<Real>(soil_block, "Density");
-    SimpleDynamics<continuum_dynamics::VerticalStress> vertical_stress(soil_block);
-    body_states_recording.addToWrite<Real>(soil_block, "VerticalStress");
-    SimpleDynamics<continuum_dynamics::AccDeviatoricPlasticStrain> accumulated_deviatoric_plastic_strain(soil_block);
-    body_states_recording.addToWrite<Real>(soil_block, "AccDeviatoricPlasticStrain");
+    body_states_recording.addDerivedVariableToWrite<continuum_dynamics::VerticalStress>(soil_block);
+    body_states_recording.addDerivedVariableToWrite<continuum_dynamics::AccDeviatoricPlasticStrain>(soil_block);
     RestartIO restart_io(sph_system);
     RegressionTestDynamicTimeWarping<ReducedQuantityRecording<TotalMechanicalEnergy>>
         write_mechanical_energy(soil_block, gravity);
@@ -204,8 +202,6 @@ int main(int ac, char *av[])
             interval_updating_configuration += TickCount::now() - time_instance;
         }
         TickCount t2 = TickCount::now();
-        vertical_stress.exec();
-        accumulated_deviatoric_plastic_strain.exec();
         body_states_recording.writeToFile();
         TickCount t3 = TickCount::now();
         interval += t3 - t2;
@@ -130,6 +130,7 @@ int main(int ac, char *av[])
     // this section define all numerical methods will be used in this case
     //-----------------------------------------------------------------------------
     InteractionWithUpdate<LinearGradientCorrectionMatrixInner> beam_corrected_configuration(beam_body_inner);
+    solid_dynamics::StaticInnerConfiguration beam_static_configuration(beam_body_inner);
 
     Dynamics1Level<solid_dynamics::Integration1stHalfPK2> stress_relaxation_first_half(beam_body_inner);
     Dynamics1Level<solid_dynamics::Integration2ndHalf> stress_relaxation_second_half(beam_body_inner);
@@ -151,6 +152,10 @@ int main(int ac, char *av[])
     sph_system.initializeSystemConfigurations();
     beam_initial_velocity.exec();
     beam_corrected_configuration.exec();
+    /** The total Lagrangian beam streams the pre-computed kernel gradients. */
+    beam_static_configuration.exec();
+    stress_relaxation_first_half.useStaticConfiguration(beam_static_configuration);
+    stress_relaxation_second_half.useStaticConfiguration(beam_static_configuration);
     //----------------------------------------------------------------------
     //	Setup computing time-step controls.
     //----------------------------------------------------------------------
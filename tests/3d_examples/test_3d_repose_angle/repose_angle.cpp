@@ -25,6 +25,9 @@ Real friction_angle = 30 * Pi / 180;
 /** Define the soil body. */
 Real inner_circle_radius = radius;
 int resolution(20);
+/** Parameters of the particle relaxation, also the key of the relaxation cache. */
+int relaxation_steps = 1000;
+Real random_displacement_ratio = 0.25;
 class SoilBlock : public ComplexShape
 {
   public:
@@ -87,9 +90,23 @@ int main(int ac, char *av[])
     RealBody soil_block(sph_system, makeShared<SoilBlock>("GranularBody"));
     soil_block.defineBodyLevelSetShape()->writeLevelSet(sph_system);
     soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
-    (!sph_system.RunParticleRelaxation() && sph_system.ReloadParticles())
-        ? soil_block.generateParticles<BaseParticles, Reload>(soil_block.getName())
-        : soil_block.generateParticles<BaseParticles, Lattice>();
+    ParticleRelaxationCache soil_relaxation_cache(soil_block, {Real(relaxation_steps), random_displacement_ratio});
+    if (sph_system.RunParticleRelaxation())
+    {
+        soil_block.generateParticles<BaseParticles, Lattice>();
+    }
+    else if (soil_relaxation_cache.isCached())
+    {
+        std::cout << "\n The relaxed particles of " << soil_block.getName() << " are loaded from the relaxation cache "
+                  << soil_relaxation_cache.ReloadName() << ", run with --r=true to relax them again." << std::endl;
+        soil_block.generateParticles<BaseParticles, Reload>(soil_relaxation_cache.ReloadName());
+    }
+    else
+    {
+        sph_system.ReloadParticles()
+            ? soil_block.generateParticles<BaseParticles, Reload>(soil_block.getName())
+            : soil_block.generateParticles<BaseParticles, Lattice>();
+    }
 
     SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
     wall_boundary.defineMaterial<Solid>();
@@ -128,14 +145,14 @@ int main(int ac, char *av[])
         //----------------------------------------------------------------------
         //	Particle relaxation starts here.
         //----------------------------------------------------------------------
-        random_column_particles.exec(0.25);
+        random_column_particles.exec(random_displacement_ratio);
         relaxation_step_inner.SurfaceBounding().exec();
         write_column_to_vtp.writeToFile(0);
         //----------------------------------------------------------------------
         //	From here iteration for particle relaxation begins.
         //----------------------------------------------------------------------
         int ite_p = 0;
-        while (ite_p < 1000)
+        while (ite_p < relaxation_steps)
         {
             relaxation_step_inner.exec();
             ite_p += 1;
@@ -147,6 +164,7 @@ int main(int ac, char *av[])
         }
         std::cout << "The physics relaxation process of cylinder body finish !" << std::endl;
         write_particle_reload_files.writeToFile(0.0);
+        soil_relaxation_cache.writeToFile();
         return 0;
     }
     //----------------------------------------------------------------------
@@ -171,10 +189,8 @@ int main(int ac, char *av[])
     BodyStatesRecordingToVtp body_states_recording(sph_system);
     body_states_recording.addToWrite<Real>(soil_block, "Density");
     body_states_recording.addToWrite<Real>(soil_block, "Pressure");
-    SimpleDynamics<continuum_dynamics::VerticalStress> vertical_stress(soil_block);
-    body_states_recording.addToWrite<Real>(soil_block, "VerticalStress");
-    SimpleDynamics<continuum_dynamics::AccDeviatoricPlasticStrain> accumulated_deviatoric_plastic_strain(soil_block);
-    body_states_recording.addToWrite<Real>(soil_block, "AccDeviatoricPlasticStrain");
+    body_states_recording.addDerivedVariableToWrite<continuum_dynamics::VerticalStress>(soil_block);
+    body_states_recording.addDerivedVariableToWrite<continuum_dynamics::AccDeviatoricPlasticStrain>(soil_block);
     RestartIO restart_io(sph_system);
     RegressionTestDynamicTimeWarping<ReducedQuantityRecording<TotalMechanicalEnergy>> write_soil_mechanical_energy(soil_block, gravity);
     //----------------------------------------------------------------------
@@ -265,8 +281,6 @@ int main(int ac, char *av[])
             interval_updating_configuration += TickCount::now() - time_instance;
         }
         TickCount t2 = TickCount::now();
-        vertical_stress.exec();
-        accumulated_deviatoric_plastic_strain.exec();
         body_states_recording.writeToFile();
         TickCount t3 = TickCount::now();
         interval += t3 - t2;
@@ -0,0 +1,149 @@
+/**
+ * @file 	benchmark_2d_column_collapse.cpp
+ * @brief 	Benchmark of the 2D soil column collapse with the legacy pipeline.
+ * @details The setup follows test_2d_column_collapse without output and regression test.
+ *          Commandline options: --resolution_scale=<Real> --end_time=<Real> --profiling=<bool>.
+ * @author	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+#include "sphinxsys.h" //SPHinXsys Library.
+using namespace SPH;   // Namespace cite here.
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 0.5;                       /**< Tank length. */
+Real DH = 0.15;                      /**< Tank height. */
+Real LL = 0.2;                       /**< Soil column length. */
+Real LH = 0.1;                       /**< Soil column height. */
+Real particle_spacing_ref = LH / 50; /**< Reference particle spacing at resolution scale 1. */
+//----------------------------------------------------------------------
+//	Material properties of the soil.
+//----------------------------------------------------------------------
+Real rho0_s = 2040;                                                       // reference density of soil
+Real gravity_g = 9.8;                                                     // gravity force of soil
+Real Youngs_modulus = 5.84e6;                                             // reference Youngs modulus
+Real poisson = 0.3;                                                       // Poisson ratio
+Real c_s = sqrt(Youngs_modulus / (rho0_s * 3.0 * (1.0 - 2.0 * poisson))); // sound speed
+Real friction_angle = 21.9 * Pi / 180;
+//----------------------------------------------------------------------
+//	Complex for wall boundary, the width depends on the resolution.
+//----------------------------------------------------------------------
+class WallBoundary : public ComplexShape
+{
+  public:
+    WallBoundary(const std::string &shape_name, Real BW) : ComplexShape(shape_name)
+    {
+        Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+        Vec2d outer_wall_translation = Vec2d(-BW, -BW) + outer_wall_halfsize;
+        Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH);
+        Vec2d inner_wall_translation = inner_wall_halfsize;
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+std::vector<Vecd> soil_shape{
+    Vecd(0, 0), Vecd(0, LH), Vecd(LL, LH), Vecd(LL, 0), Vecd(0, 0)};
+
+class Soil : public MultiPolygonShape
+{
+  public:
+    explicit Soil(const std::string &shape_name) : MultiPolygonShape(shape_name)
+    {
+        multi_polygon_.addAPolygon(soil_shape, ShapeBooleanOps::add);
+    }
+};
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    benchmark::BenchmarkOptions options = benchmark::parseBenchmarkOptions(ac, av, 0.1);
+    benchmark::BenchmarkReport report("2d_column_collapse", "legacy", options);
+    //----------------------------------------------------------------------
+    //	Build up the environment of a SPHSystem.
+    //----------------------------------------------------------------------
+    Real particle_spacing = particle_spacing_ref / options.resolution_scale_;
+    Real BW = particle_spacing * 4; /**< Extending width for boundary conditions. */
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setProfiling(options.profiling_);
+    sph_system.setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    RealBody soil_block(sph_system, makeShared<Soil>("GranularBody"));
+    soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+    soil_block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary", BW));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation soil_block_inner(soil_block);
+    ContactRelation soil_block_contact(soil_block, {&wall_boundary});
+    ComplexRelation soil_block_complex(soil_block_inner, soil_block_contact);
+    //----------------------------------------------------------------------
+    //	Define the main numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vecd(0.0, -gravity_g));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(soil_block, gravity);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+    Dynamics1Level<continuum_dynamics::PlasticIntegration1stHalfWithWallRiemann> granular_stress_relaxation(soil_block_inner, soil_block_contact);
+    Dynamics1Level<continuum_dynamics::PlasticIntegration2ndHalfWithWallRiemann> granular_density_relaxation(soil_block_inner, soil_block_contact);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplexFreeSurface> soil_density_by_summation(soil_block_inner, soil_block_contact);
+    InteractionDynamics<continuum_dynamics::StressDiffusion> stress_diffusion(soil_block_inner);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> soil_acoustic_time_step(soil_block, 0.4);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+    //----------------------------------------------------------------------
+    //	Setup for time-stepping control
+    //----------------------------------------------------------------------
+    Real &physical_time = *sph_system.getSystemVariableDataByName<Real>("PhysicalTime");
+    Real Dt = 0.002; /**< Time interval of the outer loop, as in the test case. */
+    report.setParticles(soil_block.getBaseParticles().TotalRealParticles());
+    TickCount time_instance;
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    report.startTimeStepping();
+    while (physical_time < options.end_time_)
+    {
+        time_instance = TickCount::now();
+        soil_density_by_summation.exec();
+        report.Phase("density_summation") += TickCount::now() - time_instance;
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < Dt)
+        {
+            time_instance = TickCount::now();
+            Real dt = soil_acoustic_time_step.exec();
+            report.Phase("time_step_size") += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
+            stress_diffusion.exec();
+            granular_stress_relaxation.exec(dt);
+            granular_density_relaxation.exec(dt);
+            report.Phase("acoustic_steps") += TickCount::now() - time_instance;
+
+            relaxation_time += dt;
+            physical_time += dt;
+            report.addSteps(1);
+
+            time_instance = TickCount::now();
+            soil_block.updateCellLinkedList();
+            soil_block_complex.updateConfiguration();
+            report.Phase("update_configuration") += TickCount::now() - time_instance;
+        }
+    }
+    report.writeReport(sph_system);
+
+    return 0;
+};
@@ -0,0 +1,190 @@
+/**
+ * @file 	benchmark_2d_column_collapse_ck.cpp
+ * @brief 	Benchmark of the 2D soil column collapse with the CK pipeline.
+ * @details The setup follows test_2d_column_collapse_sycl with the parallel policy and without output and regression test.
+ *          Commandline options: --resolution_scale=<Real> --end_time=<Real> --profiling=<bool> --tile_size=<int>.
+ *          The final runout and height are reported to compare the accuracy of the mixed-precision build.
+ * @author	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+#include "sphinxsys_ck.h" //SPHinXsys Library.
+using namespace SPH;   // Namespace cite here.
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 0.5;                       /**< Tank length. */
+Real DH = 0.15;                      /**< Tank height. */
+Real LL = 0.2;                       /**< Soil column length. */
+Real LH = 0.1;                       /**< Soil column height. */
+Real particle_spacing_ref = LH / 50; /**< Reference particle spacing at resolution scale 1. */
+//----------------------------------------------------------------------
+//	Material properties of the soil.
+//----------------------------------------------------------------------
+Real rho0_s = 2040;                                                       // reference density of soil
+Real gravity_g = 9.8;                                                     // gravity force of soil
+Real Youngs_modulus = 5.84e6;                                             // reference Youngs modulus
+Real poisson = 0.3;                                                       // Poisson ratio
+Real c_s = sqrt(Youngs_modulus / (rho0_s * 3.0 * (1.0 - 2.0 * poisson))); // sound speed
+Real friction_angle = 21.9 * Pi / 180;
+//----------------------------------------------------------------------
+//	Complex for wall boundary, the width depends on the resolution.
+//----------------------------------------------------------------------
+class WallBoundary : public ComplexShape
+{
+  public:
+    WallBoundary(const std::string &shape_name, Real BW) : ComplexShape(shape_name)
+    {
+        Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+        Vec2d outer_wall_translation = Vec2d(-BW, -BW) + outer_wall_halfsize;
+        Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH);
+        Vec2d inner_wall_translation = inner_wall_halfsize;
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+std::vector<Vecd> soil_shape{
+    Vecd(0, 0), Vecd(0, LH), Vecd(LL, LH), Vecd(LL, 0), Vecd(0, 0)};
+
+class Soil : public MultiPolygonShape
+{
+  public:
+    explicit Soil(const std::string &shape_name) : MultiPolygonShape(shape_name)
+    {
+        multi_polygon_.addAPolygon(soil_shape, ShapeBooleanOps::add);
+    }
+};
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    benchmark::BenchmarkOptions options = benchmark::parseBenchmarkOptions(ac, av, 0.1);
+    benchmark::BenchmarkReport report("2d_column_collapse_ck", "ck_parallel", options);
+    //----------------------------------------------------------------------
+    //	Build up the environment of a SPHSystem.
+    //----------------------------------------------------------------------
+    Real particle_spacing = particle_spacing_ref / options.resolution_scale_;
+    Real BW = particle_spacing * 4; /**< Extending width for boundary conditions. */
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setProfiling(options.profiling_);
+    sph_system.setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    RealBody soil_block(sph_system, makeShared<Soil>("GranularBody"));
+    soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+    soil_block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary", BW));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    using MyExecutionPolicy = execution::ParallelPolicy; // define execution policy for this case
+
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> soil_cell_linked_list(soil_block);
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> wall_cell_linked_list(wall_boundary);
+
+    Relation<Inner<>> soil_block_inner(soil_block);
+    Relation<Contact<>> soil_block_contact(soil_block, {&wall_boundary});
+
+    UpdateRelation<MyExecutionPolicy, Inner<>, Contact<>> soil_block_update_complex_relation(soil_block_inner, soil_block_contact);
+    ParticleSortCK<MyExecutionPolicy, QuickSort> particle_sort(soil_block);
+    //----------------------------------------------------------------------
+    //	Define the main numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vecd(0.0, -gravity_g));
+    StateDynamics<MyExecutionPolicy, GravityForceCK<Gravity>> constant_gravity(soil_block, gravity);
+    StateDynamics<MyExecutionPolicy, NormalFromBodyShapeCK> wall_boundary_normal_direction(wall_boundary);
+    StateDynamics<MyExecutionPolicy, fluid_dynamics::AdvectionStepSetup> soil_advection_step_setup(soil_block);
+    StateDynamics<MyExecutionPolicy, fluid_dynamics::AdvectionStepClose> soil_advection_step_close(soil_block);
+
+    InteractionDynamicsCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep1stHalfWithWallRiemannCK>
+        soil_acoustic_step_1st_half(soil_block_inner, soil_block_contact);
+    InteractionDynamicsCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK>
+        soil_acoustic_step_2nd_half(soil_block_inner, soil_block_contact);
+    if (options.tile_size_ != 0)
+    {
+        soil_acoustic_step_1st_half.useCellBlockTiles(options.tile_size_);
+        soil_acoustic_step_2nd_half.useCellBlockTiles(options.tile_size_);
+    }
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensityRegularizationComplexFreeSurface>
+        soil_density_regularization(soil_block_inner, soil_block_contact);
+
+    ReduceDynamicsCK<MyExecutionPolicy, fluid_dynamics::AcousticTimeStepCK> soil_acoustic_time_step(soil_block, 0.4);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    SingularVariable<Real> *sv_physical_time = sph_system.getSystemVariableByName<Real>("PhysicalTime");
+
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+
+    soil_cell_linked_list.exec();
+    wall_cell_linked_list.exec();
+    soil_block_update_complex_relation.exec();
+    //----------------------------------------------------------------------
+    //	Setup for time-stepping control
+    //----------------------------------------------------------------------
+    size_t number_of_iterations = 0;
+    Real Dt = 0.0025; /**< Time interval of the outer loop, as in the test case. */
+    report.setParticles(soil_block.getBaseParticles().TotalRealParticles());
+    TickCount time_instance;
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    report.startTimeStepping();
+    while (sv_physical_time->getValue() < options.end_time_)
+    {
+        time_instance = TickCount::now();
+        soil_density_regularization.exec();
+        soil_advection_step_setup.exec();
+        report.Phase("density_regularization") += TickCount::now() - time_instance;
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < Dt)
+        {
+            time_instance = TickCount::now();
+            Real acoustic_dt = soil_acoustic_time_step.exec();
+            report.Phase("time_step_size") += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
+            soil_acoustic_step_1st_half.exec(acoustic_dt);
+            soil_acoustic_step_2nd_half.exec(acoustic_dt);
+            report.Phase("acoustic_steps") += TickCount::now() - time_instance;
+
+            relaxation_time += acoustic_dt;
+            sv_physical_time->incrementValue(acoustic_dt);
+            report.addSteps(1);
+        }
+        number_of_iterations++;
+
+        time_instance = TickCount::now();
+        soil_advection_step_close.exec();
+        if (number_of_iterations % 100 == 0 && number_of_iterations != 1)
+        {
+            particle_sort.exec();
+        }
+        soil_cell_linked_list.exec();
+        soil_block_update_complex_relation.exec();
+        report.Phase("update_configuration") += TickCount::now() - time_instance;
+    }
+    //----------------------------------------------------------------------
+    //	Final runout and height of the column, compared between the builds
+    //	with and without SPHINXSYS_USE_MIXED_PRECISION.
+    //----------------------------------------------------------------------
+    Vecd *soil_position = soil_block.getBaseParticles().getVariableDataByName<Vecd>("Position");
+    Vecd soil_extent = Vecd::Zero();
+    for (size_t i = 0; i != soil_block.getBaseParticles().TotalRealParticles(); ++i)
+    {
+        soil_extent = soil_extent.cwiseMax(soil_position[i]);
+    }
+    report.addResult("runout", soil_extent[0]);
+    report.addResult("height", soil_extent[1]);
+    report.writeReport(sph_system);
+
+    return 0;
+};
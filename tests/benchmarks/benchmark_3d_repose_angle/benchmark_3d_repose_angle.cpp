@@ -0,0 +1,170 @@
+/**
+ * @file 	benchmark_3d_repose_angle.cpp
+ * @brief 	Benchmark of the 3D repose angle with the legacy pipeline.
+ * @details The setup follows test_3d_repose_angle without output and regression test.
+ *          The particles are generated on lattice so that no relaxation or reload is needed.
+ *          Commandline options: --resolution_scale=<Real> --end_time=<Real> --profiling=<bool>.
+ * @author	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+#include "sphinxsys.h" // SPHinXsys Library.
+using namespace SPH;
+// general parameters for geometry
+Real radius = 0.1;                                         // Soil column length
+Real height = 0.1;                                         // Soil column height
+Real resolution_ref = radius / 10;                         // particle spacing at resolution scale 1
+Real DL = 2 * radius * (1 + 1.24 * height / radius) + 0.1; // tank length
+Real DH = height + 0.02;                                   // tank height
+Real DW = DL;                                              // tank width
+// for material properties
+Real rho0_s = 2600;           // reference density of soil
+Real gravity_g = 9.8;         // gravity force of soil
+Real Youngs_modulus = 5.98e6; // reference Youngs modulus
+Real poisson = 0.3;           // Poisson ratio
+Real c_s = sqrt(Youngs_modulus / (rho0_s * 3 * (1 - 2 * poisson)));
+Real friction_angle = 30 * Pi / 180;
+/** Define the soil body. */
+Real inner_circle_radius = radius;
+int resolution(20);
+class SoilBlock : public ComplexShape
+{
+  public:
+    explicit SoilBlock(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd translation_column(DL / 2, 0.5 * height, DW / 2);
+        add<TriangleMeshShapeCylinder>(SimTK::UnitVec3(0, 1.0, 0), inner_circle_radius,
+                                       0.5 * height, resolution, translation_column);
+    }
+};
+//	define the static solid wall boundary shape, the width depends on the resolution
+class WallBoundary : public ComplexShape
+{
+  public:
+    WallBoundary(const std::string &shape_name, Real BW) : ComplexShape(shape_name)
+    {
+        Vecd outer_wall_halfsize = Vecd(0.5 * DL + BW, 0.5 * DH + BW, 0.5 * DW + BW);
+        Vecd outer_wall_translation = Vecd(-BW, -BW, -BW) + outer_wall_halfsize;
+        Vecd inner_wall_halfsize = Vecd(0.5 * DL, 0.5 * DH, 0.5 * DW);
+        Vecd inner_wall_translation = inner_wall_halfsize;
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	application dependent initial condition
+//----------------------------------------------------------------------
+class SoilInitialCondition : public continuum_dynamics::ContinuumInitialCondition
+{
+  public:
+    explicit SoilInitialCondition(RealBody &granular_column)
+        : continuum_dynamics::ContinuumInitialCondition(granular_column){};
+
+  protected:
+    void update(size_t index_i, Real dt)
+    {
+        /** initial stress */
+        Real y = pos_[index_i][1];
+        Real gama = 1 - sin(friction_angle);
+        Real stress_yy = -rho0_s * gravity_g * y;
+        stress_tensor_3D_[index_i](1, 1) = stress_yy;
+        stress_tensor_3D_[index_i](0, 0) = stress_yy * gama;
+        stress_tensor_3D_[index_i](2, 2) = stress_yy * gama;
+    };
+};
+// the main program with commandline options
+int main(int ac, char *av[])
+{
+    benchmark::BenchmarkOptions options = benchmark::parseBenchmarkOptions(ac, av, 0.02);
+    benchmark::BenchmarkReport report("3d_repose_angle", "legacy", options);
+    //----------------------------------------------------------------------
+    //	Build up an SPHSystem.
+    //----------------------------------------------------------------------
+    Real particle_spacing = resolution_ref / options.resolution_scale_;
+    Real BW = particle_spacing * 4; // boundary width
+    BoundingBox system_domain_bounds(Vecd(-BW, -BW, -BW), Vecd(DL + BW, DH + BW, DW + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setProfiling(options.profiling_);
+    sph_system.setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    RealBody soil_block(sph_system, makeShared<SoilBlock>("GranularBody"));
+    soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+    soil_block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary", BW));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation soil_block_inner(soil_block);
+    ContactRelation soil_block_contact(soil_block, {&wall_boundary});
+    ComplexRelation soil_block_complex(soil_block_inner, soil_block_contact);
+    //----------------------------------------------------------------------
+    //	Define the numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vec3d(0.0, -gravity_g, 0.0));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(soil_block, gravity);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+    SimpleDynamics<SoilInitialCondition> soil_initial_condition(soil_block);
+
+    Dynamics1Level<continuum_dynamics::PlasticIntegration1stHalfWithWallRiemann> granular_stress_relaxation(soil_block_inner, soil_block_contact);
+    Dynamics1Level<continuum_dynamics::PlasticIntegration2ndHalfWithWallRiemann> granular_density_relaxation(soil_block_inner, soil_block_contact);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplexFreeSurface> soil_density_by_summation(soil_block_inner, soil_block_contact);
+    InteractionDynamics<continuum_dynamics::StressDiffusion> stress_diffusion(soil_block_inner);
+
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> soil_acoustic_time_step(soil_block, 0.4);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    soil_initial_condition.exec();
+    constant_gravity.exec();
+    //----------------------------------------------------------------------
+    //	Setup for time-stepping control
+    //----------------------------------------------------------------------
+    Real &physical_time = *sph_system.getSystemVariableDataByName<Real>("PhysicalTime");
+    Real Dt = 0.002; /**< Time interval of the outer loop, as in the test case. */
+    report.setParticles(soil_block.getBaseParticles().TotalRealParticles());
+    TickCount time_instance;
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    report.startTimeStepping();
+    while (physical_time < options.end_time_)
+    {
+        time_instance = TickCount::now();
+        soil_density_by_summation.exec();
+        report.Phase("density_summation") += TickCount::now() - time_instance;
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < Dt)
+        {
+            time_instance = TickCount::now();
+            Real dt = soil_acoustic_time_step.exec();
+            report.Phase("time_step_size") += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
+            stress_diffusion.exec();
+            granular_stress_relaxation.exec(dt);
+            granular_density_relaxation.exec(dt);
+            report.Phase("acoustic_steps") += TickCount::now() - time_instance;
+
+            relaxation_time += dt;
+            physical_time += dt;
+            report.addSteps(1);
+
+            time_instance = TickCount::now();
+            soil_block.updateCellLinkedList();
+            soil_block_complex.updateConfiguration();
+            report.Phase("update_configuration") += TickCount::now() - time_instance;
+        }
+    }
+    report.writeReport(sph_system);
+
+    return 0;
+};
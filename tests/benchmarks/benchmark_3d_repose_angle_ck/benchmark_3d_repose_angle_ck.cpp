@@ -0,0 +1,214 @@
+/**
+ * @file 	benchmark_3d_repose_angle_ck.cpp
+ * @brief 	Benchmark of the 3D repose angle with the CK pipeline.
+ * @details The setup follows test_3d_repose_angle with the CK methods
+ *          of test_2d_column_collapse_sycl on the parallel policy, without output and regression test.
+ *          The particles are generated on lattice so that no relaxation or reload is needed.
+ *          Commandline options: --resolution_scale=<Real> --end_time=<Real> --profiling=<bool> --tile_size=<int>.
+ *          The final spreading radius and height are reported to compare the accuracy of the mixed-precision build.
+ * @author	Xiangyu Hu
+ */
+#include "benchmark_report.h"
+#include "sphinxsys_ck.h" // SPHinXsys Library.
+using namespace SPH;
+// general parameters for geometry
+Real radius = 0.1;                                         // Soil column length
+Real height = 0.1;                                         // Soil column height
+Real resolution_ref = radius / 10;                         // particle spacing at resolution scale 1
+Real DL = 2 * radius * (1 + 1.24 * height / radius) + 0.1; // tank length
+Real DH = height + 0.02;                                   // tank height
+Real DW = DL;                                              // tank width
+// for material properties
+Real rho0_s = 2600;           // reference density of soil
+Real gravity_g = 9.8;         // gravity force of soil
+Real Youngs_modulus = 5.98e6; // reference Youngs modulus
+Real poisson = 0.3;           // Poisson ratio
+Real c_s = sqrt(Youngs_modulus / (rho0_s * 3 * (1 - 2 * poisson)));
+Real friction_angle = 30 * Pi / 180;
+/** Define the soil body. */
+Real inner_circle_radius = radius;
+int resolution(20);
+class SoilBlock : public ComplexShape
+{
+  public:
+    explicit SoilBlock(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd translation_column(DL / 2, 0.5 * height, DW / 2);
+        add<TriangleMeshShapeCylinder>(SimTK::UnitVec3(0, 1.0, 0), inner_circle_radius,
+                                       0.5 * height, resolution, translation_column);
+    }
+};
+//	define the static solid wall boundary shape, the width depends on the resolution
+class WallBoundary : public ComplexShape
+{
+  public:
+    WallBoundary(const std::string &shape_name, Real BW) : ComplexShape(shape_name)
+    {
+        Vecd outer_wall_halfsize = Vecd(0.5 * DL + BW, 0.5 * DH + BW, 0.5 * DW + BW);
+        Vecd outer_wall_translation = Vecd(-BW, -BW, -BW) + outer_wall_halfsize;
+        Vecd inner_wall_halfsize = Vecd(0.5 * DL, 0.5 * DH, 0.5 * DW);
+        Vecd inner_wall_translation = inner_wall_halfsize;
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	application dependent initial condition
+//----------------------------------------------------------------------
+class SoilInitialCondition : public continuum_dynamics::ContinuumInitialCondition
+{
+  public:
+    explicit SoilInitialCondition(RealBody &granular_column)
+        : continuum_dynamics::ContinuumInitialCondition(granular_column){};
+
+  protected:
+    void update(size_t index_i, Real dt)
+    {
+        /** initial stress */
+        Real y = pos_[index_i][1];
+        Real gama = 1 - sin(friction_angle);
+        Real stress_yy = -rho0_s * gravity_g * y;
+        stress_tensor_3D_[index_i](1, 1) = stress_yy;
+        stress_tensor_3D_[index_i](0, 0) = stress_yy * gama;
+        stress_tensor_3D_[index_i](2, 2) = stress_yy * gama;
+    };
+};
+// the main program with commandline options
+int main(int ac, char *av[])
+{
+    benchmark::BenchmarkOptions options = benchmark::parseBenchmarkOptions(ac, av, 0.02);
+    benchmark::BenchmarkReport report("3d_repose_angle_ck", "ck_parallel", options);
+    //----------------------------------------------------------------------
+    //	Build up an SPHSystem.
+    //----------------------------------------------------------------------
+    Real particle_spacing = resolution_ref / options.resolution_scale_;
+    Real BW = particle_spacing * 4; // boundary width
+    BoundingBox system_domain_bounds(Vecd(-BW, -BW, -BW), Vecd(DL + BW, DH + BW, DW + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setProfiling(options.profiling_);
+    sph_system.setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    RealBody soil_block(sph_system, makeShared<SoilBlock>("GranularBody"));
+    soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+    soil_block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary", BW));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    using MyExecutionPolicy = execution::ParallelPolicy; // define execution policy for this case
+
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> soil_cell_linked_list(soil_block);
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> wall_cell_linked_list(wall_boundary);
+
+    Relation<Inner<>> soil_block_inner(soil_block);
+    Relation<Contact<>> soil_block_contact(soil_block, {&wall_boundary});
+
+    UpdateRelation<MyExecutionPolicy, Inner<>, Contact<>> soil_block_update_complex_relation(soil_block_inner, soil_block_contact);
+    ParticleSortCK<MyExecutionPolicy, QuickSort> particle_sort(soil_block);
+    //----------------------------------------------------------------------
+    //	Define the numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vec3d(0.0, -gravity_g, 0.0));
+    StateDynamics<MyExecutionPolicy, GravityForceCK<Gravity>> constant_gravity(soil_block, gravity);
+    StateDynamics<MyExecutionPolicy, NormalFromBodyShapeCK> wall_boundary_normal_direction(wall_boundary);
+    StateDynamics<MyExecutionPolicy, fluid_dynamics::AdvectionStepSetup> soil_advection_step_setup(soil_block);
+    StateDynamics<MyExecutionPolicy, fluid_dynamics::AdvectionStepClose> soil_advection_step_close(soil_block);
+
+    InteractionDynamicsCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep1stHalfWithWallRiemannCK>
+        soil_acoustic_step_1st_half(soil_block_inner, soil_block_contact);
+    InteractionDynamicsCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK>
+        soil_acoustic_step_2nd_half(soil_block_inner, soil_block_contact);
+    if (options.tile_size_ != 0)
+    {
+        soil_acoustic_step_1st_half.useCellBlockTiles(options.tile_size_);
+        soil_acoustic_step_2nd_half.useCellBlockTiles(options.tile_size_);
+    }
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensityRegularizationComplexFreeSurface>
+        soil_density_regularization(soil_block_inner, soil_block_contact);
+
+    ReduceDynamicsCK<MyExecutionPolicy, fluid_dynamics::AcousticTimeStepCK> soil_acoustic_time_step(soil_block, 0.4);
+    /** The initial stress is set on host, which shares the data with the parallel policy. */
+    SimpleDynamics<SoilInitialCondition> soil_initial_condition(soil_block);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    SingularVariable<Real> *sv_physical_time = sph_system.getSystemVariableByName<Real>("PhysicalTime");
+
+    wall_boundary_normal_direction.exec();
+    soil_initial_condition.exec();
+    constant_gravity.exec();
+
+    soil_cell_linked_list.exec();
+    wall_cell_linked_list.exec();
+    soil_block_update_complex_relation.exec();
+    //----------------------------------------------------------------------
+    //	Setup for time-stepping control
+    //----------------------------------------------------------------------
+    size_t number_of_iterations = 0;
+    Real Dt = 0.002; /**< Time interval of the outer loop, as in the test case. */
+    report.setParticles(soil_block.getBaseParticles().TotalRealParticles());
+    TickCount time_instance;
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    report.startTimeStepping();
+    while (sv_physical_time->getValue() < options.end_time_)
+    {
+        time_instance = TickCount::now();
+        soil_density_regularization.exec();
+        soil_advection_step_setup.exec();
+        report.Phase("density_regularization") += TickCount::now() - time_instance;
+
+        Real relaxation_time = 0.0;
+        while (relaxation_time < Dt)
+        {
+            time_instance = TickCount::now();
+            Real acoustic_dt = soil_acoustic_time_step.exec();
+            report.Phase("time_step_size") += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
+            soil_acoustic_step_1st_half.exec(acoustic_dt);
+            soil_acoustic_step_2nd_half.exec(acoustic_dt);
+            report.Phase("acoustic_steps") += TickCount::now() - time_instance;
+
+            relaxation_time += acoustic_dt;
+            sv_physical_time->incrementValue(acoustic_dt);
+            report.addSteps(1);
+        }
+        number_of_iterations++;
+
+        time_instance = TickCount::now();
+        soil_advection_step_close.exec();
+        if (number_of_iterations % 100 == 0 && number_of_iterations != 1)
+        {
+            particle_sort.exec();
+        }
+        soil_cell_linked_list.exec();
+        soil_block_update_complex_relation.exec();
+        report.Phase("update_configuration") += TickCount::now() - time_instance;
+    }
+    //----------------------------------------------------------------------
+    //	Final spreading radius and height of the soil pile, compared between
+    //	the builds with and without SPHINXSYS_USE_MIXED_PRECISION.
+    //----------------------------------------------------------------------
+    Vecd *soil_position = soil_block.getBaseParticles().getVariableDataByName<Vecd>("Position");
+    Real spreading_radius = 0.0;
+    Real soil_height = 0.0;
+    for (size_t i = 0; i != soil_block.getBaseParticles().TotalRealParticles(); ++i)
+    {
+        Vec2d horizontal_position(soil_position[i][0] - 0.5 * DL, soil_position[i][2] - 0.5 * DW);
+        spreading_radius = SMAX(spreading_radius, horizontal_position.norm());
+        soil_height = SMAX(soil_height, soil_position[i][1]);
+    }
+    report.addResult("spreading_radius", spreading_radius);
+    report.addResult("height", soil_height);
+    report.writeReport(sph_system);
+
+    return 0;
+};
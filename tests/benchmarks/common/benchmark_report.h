@@ -0,0 +1,200 @@
+/**
+ * @file 	benchmark_report.h
+ * @brief 	Commandline options and machine-readable report shared by the benchmark cases.
+ * @details A benchmark case runs a fixed physical problem at a resolution scaled by the
+ *          commandline option --resolution_scale and reports the throughput in
+ *          particles times steps per second, the wall time of each phase of the time stepping
+ *          and the high-water mark of the resident memory.
+ *          The report is printed and written to benchmark_<case>.json in the output folder.
+ *          With --profiling=true, the per-dynamics breakdown from DynamicsProfiler is written too.
+ *          Final-state results registered by the case, together with the storage precision,
+ *          allow to compare the accuracy and throughput of builds with and without
+ *          SPHINXSYS_USE_MIXED_PRECISION.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef BENCHMARK_REPORT_H
+#define BENCHMARK_REPORT_H
+
+#include "sphinxsys.h"
+
+#include <cstring>
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace SPH
+{
+namespace benchmark
+{
+struct BenchmarkOptions
+{
+    Real resolution_scale_ = 1.0; /**< reference particle spacing is divided by this factor */
+    Real end_time_ = 0.0;         /**< physical end time of the run */
+    bool profiling_ = false;      /**< per-dynamics breakdown by DynamicsProfiler */
+    int tile_size_ = 0;           /**< cells per direction of CK interaction tiles, 0 for flat particle order */
+};
+
+/** Options are parsed here rather than by SPHSystem, which does not accept unknown options. */
+inline BenchmarkOptions parseBenchmarkOptions(int ac, char *av[], Real default_end_time)
+{
+    BenchmarkOptions options;
+    options.end_time_ = default_end_time;
+    for (int i = 1; i < ac; ++i)
+    {
+        std::string argument(av[i]);
+        size_t separator = argument.find('=');
+        std::string key = argument.substr(0, separator);
+        std::string value = separator == std::string::npos ? "" : argument.substr(separator + 1);
+        if (key == "--resolution_scale")
+        {
+            options.resolution_scale_ = std::stod(value);
+        }
+        else if (key == "--end_time")
+        {
+            options.end_time_ = std::stod(value);
+        }
+        else if (key == "--profiling")
+        {
+            options.profiling_ = value.empty() || value == "true" || value == "1";
+        }
+        else if (key == "--tile_size")
+        {
+            options.tile_size_ = std::stoi(value);
+        }
+        else
+        {
+            std::cout << "\n Error: unknown benchmark option " << argument << "!" << std::endl;
+            std::cout << " Options: --resolution_scale=<Real> --end_time=<Real> --profiling=<bool> --tile_size=<int>" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+
+    if (options.resolution_scale_ <= 0.0 || options.end_time_ <= 0.0 || options.tile_size_ < 0)
+    {
+        std::cout << "\n Error: resolution scale and end time should be positive and tile size non-negative!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    return options;
+}
+
+/** High-water mark of the resident memory of the process in bytes, zero if not available. */
+inline size_t peakResidentMemory()
+{
+#if defined(__linux__)
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? size_t(usage.ru_maxrss) * 1024 : 0;
+#elif defined(__APPLE__)
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? size_t(usage.ru_maxrss) : 0;
+#else
+    return 0;
+#endif
+}
+
+class BenchmarkReport
+{
+  public:
+    BenchmarkReport(const std::string &case_name, const std::string &pipeline, const BenchmarkOptions &options)
+        : case_name_(case_name), pipeline_(pipeline), options_(options),
+          start_(TickCount::now()){};
+
+    /** Accumulated wall time of a phase, the order of first use is kept in the report. */
+    TimeInterval &Phase(const std::string &phase_name)
+    {
+        for (auto &phase : phases_)
+        {
+            if (phase.first == phase_name)
+                return phase.second;
+        }
+        phases_.emplace_back(phase_name, TimeInterval());
+        return phases_.back().second;
+    };
+    void setParticles(size_t total_particles) { total_particles_ = total_particles; };
+    void addSteps(size_t steps) { steps_ += steps; };
+    /** Final-state quantity of the case, used to check the accuracy of a build. */
+    void addResult(const std::string &result_name, Real value) { results_.emplace_back(result_name, value); };
+    /** Time before the call is reported as setup, i.e. body, particle and relation construction. */
+    void startTimeStepping()
+    {
+        setup_time_ = TickCount::now() - start_;
+        time_stepping_start_ = TickCount::now();
+    };
+
+    void writeReport(SPHSystem &sph_system)
+    {
+        Real time_stepping = (TickCount::now() - time_stepping_start_).seconds();
+        Real throughput = time_stepping > 0.0 ? Real(total_particles_) * Real(steps_) / time_stepping : 0.0;
+        size_t peak_memory = peakResidentMemory();
+
+        std::cout << "\n Benchmark " << case_name_ << " (" << pipeline_ << ")\n";
+        std::cout << std::fixed << std::setprecision(6)
+                  << "  particles: " << total_particles_ << ", steps: " << steps_ << "\n"
+                  << "  setup [s]: " << setup_time_.seconds()
+                  << ", time stepping [s]: " << time_stepping << "\n"
+                  << std::scientific << "  particles*steps/s: " << throughput << "\n";
+        for (auto &phase : phases_)
+        {
+            std::cout << std::fixed << "  " << phase.first << " [s]: " << phase.second.seconds() << "\n";
+        }
+        for (auto &result : results_)
+        {
+            std::cout << std::scientific << "  " << result.first << ": " << result.second << "\n";
+        }
+        std::cout << std::fixed << "  peak resident memory [MB]: " << Real(peak_memory) / (1024.0 * 1024.0) << std::endl;
+
+        std::string filefullpath = sph_system.getIOEnvironment().output_folder_ +
+                                   "/benchmark_" + case_name_ + ".json";
+        std::ofstream out_file(filefullpath.c_str(), std::ios::trunc);
+        out_file << std::setprecision(9) << "{\n"
+                 << "  \"case\": \"" << case_name_ << "\",\n"
+                 << "  \"pipeline\": \"" << pipeline_ << "\",\n"
+                 << "  \"dimensions\": " << Dimensions << ",\n"
+                 << "  \"threads\": " << tbb::this_task_arena::max_concurrency() << ",\n"
+                 << "  \"real_bytes\": " << sizeof(Real) << ",\n"
+                 << "  \"storage_real_bytes\": " << sizeof(StorageReal) << ",\n"
+                 << "  \"resolution_scale\": " << options_.resolution_scale_ << ",\n"
+                 << "  \"resolution_ref\": " << sph_system.ReferenceResolution() << ",\n"
+                 << "  \"end_time\": " << options_.end_time_ << ",\n"
+                 << "  \"particles\": " << total_particles_ << ",\n"
+                 << "  \"steps\": " << steps_ << ",\n"
+                 << "  \"setup_time\": " << setup_time_.seconds() << ",\n"
+                 << "  \"time_stepping_time\": " << time_stepping << ",\n"
+                 << "  \"particle_steps_per_second\": " << throughput << ",\n"
+                 << "  \"peak_resident_memory_bytes\": " << peak_memory << ",\n"
+                 << "  \"phases\": {";
+        for (size_t i = 0; i != phases_.size(); ++i)
+        {
+            out_file << (i == 0 ? "\n" : ",\n")
+                     << "    \"" << phases_[i].first << "\": " << phases_[i].second.seconds();
+        }
+        out_file << "\n  },\n  \"results\": {";
+        for (size_t i = 0; i != results_.size(); ++i)
+        {
+            out_file << (i == 0 ? "\n" : ",\n")
+                     << "    \"" << results_[i].first << "\": " << results_[i].second;
+        }
+        out_file << "\n  }\n}\n";
+        out_file.close();
+
+        if (sph_system.Profiling())
+            dynamics_profiler.writeSummary();
+    };
+
+  protected:
+    std::string case_name_;
+    std::string pipeline_;
+    BenchmarkOptions options_;
+    StdVec<std::pair<std::string, TimeInterval>> phases_;
+    StdVec<std::pair<std::string, Real>> results_;
+    size_t total_particles_ = 0;
+    size_t steps_ = 0;
+    TickCount start_;
+    TickCount time_stepping_start_;
+    TimeInterval setup_time_;
+};
+} // namespace benchmark
+} // namespace SPH
+#endif // BENCHMARK_REPORT_H
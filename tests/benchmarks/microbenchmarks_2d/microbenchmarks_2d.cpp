@@ -0,0 +1,412 @@
+/**
+ * @file 	microbenchmarks_2d.cpp
+ * @brief 	Google-Benchmark microbenchmarks of neighbor search, sorting and kernel primitives.
+ * @details The primitives are measured in isolation on synthetic particle clouds.
+ *          A cloud is a randomized lattice in the unit square with a given number of particles
+ *          per side (size) and ratio between smoothing length and particle spacing (density).
+ *          The arguments are given in the registration of each benchmark, and single cases are
+ *          selected at runtime with --benchmark_filter, e.g. --benchmark_filter=NeighborSearch/64.
+ *          The inner interaction of the linear correction matrix is measured in flat particle order
+ *          and by cell block tiles of 2 and 4 cells per direction.
+ *          The plastic update with float storage of the continuum fields, as in the build with
+ *          SPHINXSYS_USE_MIXED_PRECISION, reports its speedup and error against the storage in Real.
+ * @author	Xiangyu Hu
+ */
+#include "sphinxsys_ck.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Synthetic particle cloud.
+//----------------------------------------------------------------------
+class SyntheticParticleCloud
+{
+  public:
+    SyntheticParticleCloud(size_t particles_per_side, Real h_spacing_ratio)
+        : particle_spacing_(1.0 / Real(particles_per_side)),
+          cloud_shape_(Transform(0.5 * Vecd::Ones()), 0.5 * Vecd::Ones(), "Cloud"),
+          sph_system_(BoundingBox(-0.1 * Vecd::Ones(), 1.1 * Vecd::Ones()), particle_spacing_),
+          cloud_(sph_system_, cloud_shape_)
+    {
+        cloud_.defineAdaptationRatios(h_spacing_ratio);
+        cloud_.defineMaterial<PlasticContinuum>(2040.0, 30.0, 5.84e6, 0.3, 21.9 * Pi / 180);
+        cloud_.generateParticles<BaseParticles, Lattice>();
+        SimpleDynamics<relax_dynamics::RandomizeParticlePosition> randomize_particle_position(cloud_);
+        randomize_particle_position.exec(0.25);
+    };
+
+    RealBody &Body() { return cloud_; };
+    BaseParticles &Particles() { return cloud_.getBaseParticles(); };
+    UnsignedInt TotalRealParticles() { return Particles().TotalRealParticles(); };
+    Kernel &getKernel() { return *cloud_.sph_adaptation_->getKernel(); };
+
+  protected:
+    Real particle_spacing_;
+    TransformShape<GeometricShapeBox> cloud_shape_;
+    SPHSystem sph_system_;
+    RealBody cloud_;
+};
+
+/** Arguments: particles per side and smoothing length to spacing ratio in percent. */
+void CloudArguments(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->ArgsProduct({{64, 128, 256}, {115, 130, 200}})->Unit(benchmark::kMicrosecond);
+}
+
+Real DensityArgument(const benchmark::State &state) { return Real(state.range(1)) * 0.01; }
+
+void setParticleCounters(benchmark::State &state, UnsignedInt total_particles)
+{
+    state.SetItemsProcessed(state.iterations() * total_particles);
+    state.counters["particles"] = total_particles;
+}
+//----------------------------------------------------------------------
+//	Cell linked list and neighbor search.
+//----------------------------------------------------------------------
+template <class ExecutionPolicy>
+void UpdateCellLinkedListBenchmark(benchmark::State &state)
+{
+    SyntheticParticleCloud cloud(state.range(0), DensityArgument(state));
+    UpdateCellLinkedList<ExecutionPolicy, CellLinkedList> update_cell_linked_list(cloud.Body());
+
+    for (auto _ : state)
+    {
+        update_cell_linked_list.exec();
+    }
+    setParticleCounters(state, cloud.TotalRealParticles());
+}
+BENCHMARK_TEMPLATE(UpdateCellLinkedListBenchmark, execution::SequencedPolicy)->Apply(CloudArguments);
+BENCHMARK_TEMPLATE(UpdateCellLinkedListBenchmark, execution::ParallelPolicy)->Apply(CloudArguments);
+
+template <class ExecutionPolicy>
+void NeighborSearchBenchmark(benchmark::State &state)
+{
+    SyntheticParticleCloud cloud(state.range(0), DensityArgument(state));
+    UpdateCellLinkedList<ExecutionPolicy, CellLinkedList> update_cell_linked_list(cloud.Body());
+    update_cell_linked_list.exec();
+
+    ExecutionPolicy ex_policy;
+    CellLinkedList &cell_linked_list = DynamicCast<CellLinkedList>(&cloud, cloud.Body().getCellLinkedList());
+    DiscreteVariable<Vecd> *dv_pos = cloud.Particles().getVariableByName<Vecd>("Position");
+    NeighborSearch neighbor_search = cell_linked_list.createNeighborSearch(ex_policy, dv_pos);
+    Vecd *pos = dv_pos->DelegatedDataField(ex_policy);
+    UnsignedInt total_real_particles = cloud.TotalRealParticles();
+    StdVec<UnsignedInt> neighbor_count(total_real_particles, 0);
+    UnsignedInt *count = neighbor_count.data();
+
+    for (auto _ : state)
+    {
+        particle_for(ex_policy, IndexRange(0, total_real_particles),
+                     [=](size_t index_i)
+                     {
+                         UnsignedInt neighbors = 0;
+                         neighbor_search.forEachSearch(index_i, pos, [&](UnsignedInt index_j)
+                                                       { ++neighbors; });
+                         count[index_i] = neighbors;
+                     });
+        benchmark::ClobberMemory();
+    }
+    setParticleCounters(state, total_real_particles);
+    state.counters["neighbors"] =
+        Real(std::accumulate(neighbor_count.begin(), neighbor_count.end(), size_t(0))) / Real(total_real_particles);
+}
+BENCHMARK_TEMPLATE(NeighborSearchBenchmark, execution::SequencedPolicy)->Apply(CloudArguments);
+BENCHMARK_TEMPLATE(NeighborSearchBenchmark, execution::ParallelPolicy)->Apply(CloudArguments);
+
+void CellBlockTilingBenchmark(benchmark::State &state, UnsignedInt tile_size)
+{
+    SyntheticParticleCloud cloud(state.range(0), DensityArgument(state));
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> update_cell_linked_list(cloud.Body());
+    Relation<Inner<>> cloud_inner(cloud.Body());
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_cloud_inner(cloud_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, LinearCorrectionMatrixInner> correction_matrix(cloud_inner);
+    update_cell_linked_list.exec();
+    update_cloud_inner.exec();
+    if (tile_size != 0)
+    {
+        correction_matrix.useCellBlockTiles(tile_size);
+    }
+
+    for (auto _ : state)
+    {
+        correction_matrix.exec();
+        benchmark::ClobberMemory();
+    }
+    setParticleCounters(state, cloud.TotalRealParticles());
+}
+BENCHMARK_CAPTURE(CellBlockTilingBenchmark, flat, 0)->Apply(CloudArguments);
+BENCHMARK_CAPTURE(CellBlockTilingBenchmark, tile2, 2)->Apply(CloudArguments);
+BENCHMARK_CAPTURE(CellBlockTilingBenchmark, tile4, 4)->Apply(CloudArguments);
+//----------------------------------------------------------------------
+//	Exclusive scan and particle sorting.
+//----------------------------------------------------------------------
+template <class ExecutionPolicy>
+void ExclusiveScanBenchmark(benchmark::State &state)
+{
+    UnsignedInt list_size = state.range(0);
+    std::mt19937 random_engine(0);
+    std::uniform_int_distribution<UnsignedInt> cell_size(0, 8);
+    StdVec<UnsignedInt> input(list_size);
+    for (auto &entry : input)
+        entry = cell_size(random_engine);
+    StdVec<UnsignedInt> output(list_size, 0);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            exclusive_scan(ExecutionPolicy{}, input.data(), output.data(), list_size,
+                           typename PlusUnsignedInt<ExecutionPolicy>::type()));
+    }
+    state.SetItemsProcessed(state.iterations() * list_size);
+}
+BENCHMARK_TEMPLATE(ExclusiveScanBenchmark, execution::SequencedPolicy)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ExclusiveScanBenchmark, execution::ParallelPolicy)
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMicrosecond);
+
+template <class ExecutionPolicy, class SortMethodType>
+void ParticleSortBenchmark(benchmark::State &state)
+{
+    SyntheticParticleCloud cloud(state.range(0), DensityArgument(state));
+    UnsignedInt total_real_particles = cloud.TotalRealParticles();
+    DiscreteVariable<UnsignedInt> dv_sequence("Sequence", total_real_particles);
+    DiscreteVariable<UnsignedInt> dv_index_permutation("IndexPermutation", total_real_particles);
+    SortMethodType sort_method(ExecutionPolicy{}, &dv_sequence, &dv_index_permutation);
+
+    /** The sequence is the linear cell index of the randomized particle positions, as in ParticleSortCK. */
+    Mesh mesh(DynamicCast<CellLinkedList>(&cloud, cloud.Body().getCellLinkedList()));
+    Vecd *pos = cloud.Particles().ParticlePositions();
+    StdVec<UnsignedInt> unsorted_sequence(total_real_particles);
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+        unsorted_sequence[i] = mesh.LinearCellIndexFromPosition(pos[i]);
+    std::shuffle(unsorted_sequence.begin(), unsorted_sequence.end(), std::mt19937(0));
+
+    UnsignedInt *sequence = dv_sequence.DataField();
+    UnsignedInt *index_permutation = dv_index_permutation.DataField();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::copy(unsorted_sequence.begin(), unsorted_sequence.end(), sequence);
+        std::iota(index_permutation, index_permutation + total_real_particles, 0);
+        state.ResumeTiming();
+
+        sort_method.sort(ExecutionPolicy{}, &cloud.Particles());
+    }
+    setParticleCounters(state, total_real_particles);
+}
+BENCHMARK_TEMPLATE(ParticleSortBenchmark, execution::ParallelPolicy, QuickSort)->Apply(CloudArguments);
+BENCHMARK_TEMPLATE(ParticleSortBenchmark, execution::SequencedPolicy, RadixSort)->Apply(CloudArguments);
+BENCHMARK_TEMPLATE(ParticleSortBenchmark, execution::ParallelPolicy, RadixSort)->Apply(CloudArguments);
+//----------------------------------------------------------------------
+//	Smoothing kernel evaluation.
+//----------------------------------------------------------------------
+StdVec<Vecd> randomDisplacements(size_t number_of_pairs, Real cutoff_radius)
+{
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<Real> component(-cutoff_radius, cutoff_radius);
+    StdVec<Vecd> displacements;
+    while (displacements.size() != number_of_pairs)
+    {
+        Vecd displacement = Vecd::Zero();
+        for (int k = 0; k != Dimensions; ++k)
+            displacement[k] = component(random_engine);
+        if (displacement.norm() < cutoff_radius)
+            displacements.push_back(displacement);
+    }
+    return displacements;
+}
+
+template <class KernelFunction>
+void KernelWendlandC2CKBenchmark(benchmark::State &state, const KernelFunction &kernel_function)
+{
+    SyntheticParticleCloud cloud(16, 1.3);
+    KernelWendlandC2CK kernel(cloud.getKernel());
+    StdVec<Vecd> displacements = randomDisplacements(state.range(0), kernel.CutOffRadius());
+
+    for (auto _ : state)
+    {
+        Real sum = 0.0;
+        for (const Vecd &displacement : displacements)
+            sum += kernel_function(kernel, displacement);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * displacements.size());
+}
+BENCHMARK_CAPTURE(KernelWendlandC2CKBenchmark, W,
+                  [](const KernelWendlandC2CK &kernel, const Vecd &displacement)
+                  { return kernel.W(displacement); })
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(KernelWendlandC2CKBenchmark, dW,
+                  [](const KernelWendlandC2CK &kernel, const Vecd &displacement)
+                  { return kernel.dW(displacement); })
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMicrosecond);
+//----------------------------------------------------------------------
+//	Drucker-Prager plasticity.
+//----------------------------------------------------------------------
+/** Velocity gradients and stresses of a granular column with a fraction of yielded states. */
+void randomPlasticStates(size_t number_of_states, StdVec<Mat3d> &velocity_gradients, StdVec<Mat3d> &stresses)
+{
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<Real> unit(-1.0, 1.0);
+    velocity_gradients.resize(number_of_states);
+    stresses.resize(number_of_states);
+    for (size_t n = 0; n != number_of_states; ++n)
+    {
+        Real confining_pressure = 2.0e3 * (1.0 + unit(random_engine));
+        for (int i = 0; i != 3; ++i)
+            for (int j = 0; j != 3; ++j)
+            {
+                velocity_gradients[n](i, j) = 10.0 * unit(random_engine);
+                stresses[n](i, j) = (i == j ? -confining_pressure : 0.0) + 1.0e3 * unit(random_engine);
+            }
+        stresses[n] = 0.5 * (stresses[n] + stresses[n].transpose()).eval();
+    }
+}
+
+void PlasticKernelConstitutiveRelationBenchmark(benchmark::State &state)
+{
+    PlasticContinuum plastic_continuum(2040.0, 30.0, 5.84e6, 0.3, 21.9 * Pi / 180);
+    PlasticContinuum::PlasticKernel plastic_kernel(plastic_continuum);
+    StdVec<Mat3d> velocity_gradients, stresses;
+    randomPlasticStates(state.range(0), velocity_gradients, stresses);
+
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n != stresses.size(); ++n)
+            benchmark::DoNotOptimize(plastic_kernel.ConstitutiveRelation(velocity_gradients[n], stresses[n]));
+    }
+    state.SetItemsProcessed(state.iterations() * stresses.size());
+}
+BENCHMARK(PlasticKernelConstitutiveRelationBenchmark)->Arg(1 << 14)->Unit(benchmark::kMicrosecond);
+
+void PlasticKernelReturnMappingBenchmark(benchmark::State &state)
+{
+    PlasticContinuum plastic_continuum(2040.0, 30.0, 5.84e6, 0.3, 21.9 * Pi / 180);
+    PlasticContinuum::PlasticKernel plastic_kernel(plastic_continuum);
+    StdVec<Mat3d> velocity_gradients, stresses;
+    randomPlasticStates(state.range(0), velocity_gradients, stresses);
+    StdVec<Mat3d> mapped_stresses(stresses);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::copy(stresses.begin(), stresses.end(), mapped_stresses.begin());
+        state.ResumeTiming();
+
+        for (size_t n = 0; n != mapped_stresses.size(); ++n)
+            benchmark::DoNotOptimize(plastic_kernel.ReturnMapping(mapped_stresses[n]));
+    }
+    state.SetItemsProcessed(state.iterations() * stresses.size());
+}
+BENCHMARK(PlasticKernelReturnMappingBenchmark)->Arg(1 << 14)->Unit(benchmark::kMicrosecond);
+
+//----------------------------------------------------------------------
+//	Storage precision of the plastic continuum fields.
+//----------------------------------------------------------------------
+/** The stress and strain fields of the CK plastic update stored in a given precision. */
+template <typename StorageType>
+class PlasticUpdateFields
+{
+    using StorageMatrix = Eigen::Matrix<StorageType, 3, 3>;
+
+  public:
+    PlasticUpdateFields(const StdVec<Mat3d> &velocity_gradients, const StdVec<Mat3d> &stresses)
+        : velocity_gradient_(velocity_gradients.size()), stress_tensor_3D_(stresses.size()),
+          strain_tensor_3D_(stresses.size(), StorageMatrix::Zero()),
+          stress_rate_3D_(stresses.size()), strain_rate_3D_(stresses.size())
+    {
+        for (size_t n = 0; n != stresses.size(); ++n)
+        {
+            velocity_gradient_[n] = velocity_gradients[n].template cast<StorageType>();
+            stress_tensor_3D_[n] = stresses[n].template cast<StorageType>();
+        }
+    };
+
+    /** As in the update of PlasticAcousticStep2ndHalf, the computation is in Real. */
+    void update(PlasticContinuum::PlasticKernel &plastic_kernel, Real dt)
+    {
+        particle_for(execution::par, IndexRange(0, stress_tensor_3D_.size()),
+                     [&](size_t index_i)
+                     {
+                         Mat3d velocity_gradient = velocity_gradient_[index_i].template cast<Real>();
+                         Mat3d stress_tensor = stress_tensor_3D_[index_i].template cast<Real>();
+                         Mat3d stress_tensor_rate_3D_ = plastic_kernel.ConstitutiveRelation(velocity_gradient, stress_tensor);
+                         stress_rate_3D_[index_i] = stress_tensor_rate_3D_.template cast<StorageType>();
+                         stress_tensor += stress_tensor_rate_3D_ * dt;
+                         stress_tensor_3D_[index_i] = plastic_kernel.ReturnMapping(stress_tensor).template cast<StorageType>();
+                         Mat3d strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+                         strain_rate_3D_[index_i] = strain_rate.template cast<StorageType>();
+                         strain_tensor_3D_[index_i] += (strain_rate * dt).template cast<StorageType>();
+                     });
+    };
+
+    /** Error norms of stress and strain relative to the norms of the fields of a reference. */
+    Vec2d RelativeError(const PlasticUpdateFields<Real> &reference)
+    {
+        Vec2d error_squared = Vec2d::Zero();
+        Vec2d reference_squared = Vec2d::Constant(TinyReal);
+        for (size_t n = 0; n != stress_tensor_3D_.size(); ++n)
+        {
+            error_squared += Vec2d((stress_tensor_3D_[n].template cast<Real>() - reference.stress_tensor_3D_[n]).squaredNorm(),
+                                   (strain_tensor_3D_[n].template cast<Real>() - reference.strain_tensor_3D_[n]).squaredNorm());
+            reference_squared += Vec2d(reference.stress_tensor_3D_[n].squaredNorm(), reference.strain_tensor_3D_[n].squaredNorm());
+        }
+        return error_squared.cwiseQuotient(reference_squared).cwiseSqrt();
+    };
+
+    StdVec<StorageMatrix> velocity_gradient_, stress_tensor_3D_, strain_tensor_3D_, stress_rate_3D_, strain_rate_3D_;
+};
+
+/** Throughput of the plastic update with the fields stored in StorageType,
+ *  reported with its speedup and relative error against the storage in Real. */
+template <typename StorageType>
+void PlasticUpdateStoragePrecisionBenchmark(benchmark::State &state)
+{
+    PlasticContinuum plastic_continuum(2040.0, 30.0, 5.84e6, 0.3, 21.9 * Pi / 180);
+    PlasticContinuum::PlasticKernel plastic_kernel(plastic_continuum);
+    StdVec<Mat3d> velocity_gradients, stresses;
+    randomPlasticStates(state.range(0), velocity_gradients, stresses);
+    size_t number_of_steps = 20;
+    Real dt = 5.0e-6;
+
+    Real storage_time = 0.0;
+    Real reference_time = 0.0;
+    Vec2d relative_error = Vec2d::Zero();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        PlasticUpdateFields<StorageType> fields(velocity_gradients, stresses);
+        PlasticUpdateFields<Real> reference_fields(velocity_gradients, stresses);
+        state.ResumeTiming();
+
+        TickCount t1 = TickCount::now();
+        for (size_t step = 0; step != number_of_steps; ++step)
+            fields.update(plastic_kernel, dt);
+        TickCount t2 = TickCount::now();
+        storage_time += (t2 - t1).seconds();
+
+        state.PauseTiming();
+        for (size_t step = 0; step != number_of_steps; ++step)
+            reference_fields.update(plastic_kernel, dt);
+        reference_time += (TickCount::now() - t2).seconds();
+        relative_error = relative_error.cwiseMax(fields.RelativeError(reference_fields));
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * number_of_steps * stresses.size());
+    state.counters["speedup"] = reference_time / storage_time;
+    state.counters["stress_error"] = relative_error[0];
+    state.counters["strain_error"] = relative_error[1];
+}
+BENCHMARK_TEMPLATE(PlasticUpdateStoragePrecisionBenchmark, float)
+    ->Arg(1 << 14)
+    ->Arg(1 << 18)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
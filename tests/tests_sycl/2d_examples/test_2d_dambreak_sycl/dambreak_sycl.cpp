@@ -76,6 +76,7 @@ int main(int ac, char *av[])
     //  Generally, we first define all the inner relations, then the contact relations.
     //----------------------------------------------------------------------
     using MyExecutionPolicy = execution::ParallelDevicePolicy; // define execution policy for this case
+    execution::execution_instance.setAsynchronous(true);       // kernels are chained by events without waiting
 
     UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> water_cell_linked_list(water_block);
     UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> wall_cell_linked_list(wall_boundary);
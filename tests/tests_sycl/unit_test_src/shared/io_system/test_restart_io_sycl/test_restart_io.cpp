@@ -0,0 +1,92 @@
+/**
+ * @file 	test_restart_io.cpp
+ * @brief 	test that the restart files written from device data in binary
+ *          restore the same particle states on host and device.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys_sycl.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+size_t restart_step = 100;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+
+TEST(RestartIO, DeviceRoundTrip)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    particles.registerStateVariable<Vecd>("Velocity");
+    particles.registerStateVariable<Real>("Pressure");
+    particles.addVariableToRestart<Vecd>("Velocity");
+    particles.addVariableToRestart<Real>("Pressure");
+    RestartIO restart_io(sph_system);
+    //----------------------------------------------------------------------
+    //	The states are only updated on device before writing.
+    //----------------------------------------------------------------------
+    Vecd *pos = particles.getVariableByName<Vecd>("Position")->DelegatedDataField(par_device);
+    DiscreteVariable<Vecd> *dv_vel = particles.getVariableByName<Vecd>("Velocity");
+    DiscreteVariable<Real> *dv_p = particles.getVariableByName<Real>("Pressure");
+    Vecd *device_vel = dv_vel->DelegatedDataField(par_device);
+    Real *device_p = dv_p->DelegatedDataField(par_device);
+    particle_for(par_device, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     device_vel[i] = pos[i] - Vecd(0.5 * DL, 0.5 * DH);
+                     device_p[i] = Real(i);
+                 });
+    restart_io.writeToFile(par_device, restart_step);
+    //----------------------------------------------------------------------
+    //	Reset the states on host and device, and restore them from the files.
+    //----------------------------------------------------------------------
+    particle_for(par_device, IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 {
+                     device_vel[i] = Vecd::Zero();
+                     device_p[i] = 0.0;
+                 });
+    execution::execution_instance.synchronize();
+    dv_vel->synchronizeWithDevice();
+    dv_p->synchronizeWithDevice();
+    restart_io.readRestartFiles(par_device, restart_step);
+
+    StdVec<Vecd> vel(total_real_particles);
+    StdVec<Real> p(total_real_particles);
+    copyFromDevice(vel.data(), device_vel, total_real_particles);
+    copyFromDevice(p.data(), device_p, total_real_particles);
+    Vecd *host_pos = particles.ParticlePositions();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        Vecd expected_vel = host_pos[i] - Vecd(0.5 * DL, 0.5 * DH);
+        EXPECT_EQ(vel[i], expected_vel);
+        EXPECT_EQ(p[i], Real(i));
+        EXPECT_EQ(dv_vel->DataField()[i], expected_vel);
+        EXPECT_EQ(dv_p->DataField()[i], Real(i));
+    }
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -31,6 +31,105 @@ TEST(exclusive_scan, test_sycl)
     EXPECT_EQ(sum, sycl_sum);
 }
 
+/** The previous implementation, in which only the first work group scans, for timing comparison. */
+template <typename T, typename Op>
+T single_work_group_exclusive_scan(T *first, T *d_first, UnsignedInt d_size, Op op)
+{
+    execution::execution_instance.submit([=](sycl::handler &cgh)
+                                         { cgh.parallel_for(
+                                               execution::execution_instance.getUniformNdRange(
+                                                   execution::execution_instance.getWorkGroupSize()),
+                                               [=](sycl::nd_item<1> item)
+                                               {
+                                                   if (item.get_group_linear_id() == 0)
+                                                   {
+                                                       sycl::joint_exclusive_scan(
+                                                           item.get_group(), first, first + d_size, d_first, T{0}, op);
+                                                   }
+                                               }); });
+    T last_value;
+    copyFromDevice(&last_value, d_first + d_size - 1, 1);
+    return last_value;
+}
+
+/** The sizes around the block boundaries and a large size, also with the asynchronous submission
+ *  in which the three phases and the following copy are only chained by events. */
+void testMultipleWorkGroups(bool is_asynchronous)
+{
+    execution::execution_instance.setAsynchronous(is_asynchronous);
+    UnsignedInt block_size = 8 * execution::execution_instance.getWorkGroupSize();
+    StdVec<UnsignedInt> test_sizes{1, 2, block_size - 1, block_size, block_size + 1,
+                                   7 * block_size + 3, 1000003};
+    for (UnsignedInt size : test_sizes)
+    {
+        StdVec<UnsignedInt> list(size);
+        for (UnsignedInt i = 0; i != size; ++i)
+            list[i] = (i * 7 + 3) % 13;
+        StdVec<UnsignedInt> reference(size, 0);
+        UnsignedInt sum = exclusive_scan(SequencedPolicy{}, list.data(), reference.data(), size,
+                                         PlusUnsignedInt<SequencedPolicy>::type());
+
+        UnsignedInt *device_list = allocateDeviceOnly<UnsignedInt>(size);
+        UnsignedInt *device_result = allocateDeviceOnly<UnsignedInt>(size);
+        copyToDevice(list.data(), device_list, size);
+        UnsignedInt sycl_sum = exclusive_scan(ParallelDevicePolicy{}, device_list, device_result, size,
+                                              PlusUnsignedInt<ParallelDevicePolicy>::type());
+        StdVec<UnsignedInt> device_scan(size, 0);
+        copyFromDevice(device_scan.data(), device_result, size);
+        freeDeviceData(device_list);
+        freeDeviceData(device_result);
+
+        EXPECT_EQ(reference, device_scan) << "size " << size;
+        EXPECT_EQ(sum, sycl_sum) << "size " << size;
+    }
+    execution::execution_instance.setAsynchronous(false);
+}
+
+TEST(exclusive_scan, test_sycl_multiple_work_groups)
+{
+    testMultipleWorkGroups(false);
+    testMultipleWorkGroups(true);
+}
+
+TEST(exclusive_scan, timing_sycl)
+{
+    std::cout << "Device: " << execution::execution_instance.getQueue()
+                                   .get_device()
+                                   .get_info<sycl::info::device::name>()
+              << std::endl;
+    size_t repeats = 20;
+    for (UnsignedInt size : {UnsignedInt(1) << 16, UnsignedInt(1) << 20, UnsignedInt(1) << 23})
+    {
+        StdVec<UnsignedInt> list(size, 1);
+        UnsignedInt *device_list = allocateDeviceOnly<UnsignedInt>(size);
+        UnsignedInt *device_result = allocateDeviceOnly<UnsignedInt>(size);
+        copyToDevice(list.data(), device_list, size);
+
+        // warm up, also for the compilation of the kernels
+        single_work_group_exclusive_scan(device_list, device_result, size, PlusUnsignedInt<ParallelDevicePolicy>::type());
+        exclusive_scan(ParallelDevicePolicy{}, device_list, device_result, size, PlusUnsignedInt<ParallelDevicePolicy>::type());
+
+        TickCount t1 = TickCount::now();
+        for (size_t k = 0; k != repeats; ++k)
+            single_work_group_exclusive_scan(device_list, device_result, size, PlusUnsignedInt<ParallelDevicePolicy>::type());
+        TimeInterval single_work_group = TickCount::now() - t1;
+
+        TickCount t2 = TickCount::now();
+        UnsignedInt sum = 0;
+        for (size_t k = 0; k != repeats; ++k)
+            sum = exclusive_scan(ParallelDevicePolicy{}, device_list, device_result, size, PlusUnsignedInt<ParallelDevicePolicy>::type());
+        TimeInterval multiple_work_groups = TickCount::now() - t2;
+
+        freeDeviceData(device_list);
+        freeDeviceData(device_result);
+
+        EXPECT_EQ(sum, size - 1);
+        std::cout << "Exclusive scan of " << size << " items, mean time [ms]: single work group "
+                  << 1.0e3 * single_work_group.seconds() / repeats << ", multiple work groups "
+                  << 1.0e3 * multiple_work_groups.seconds() / repeats << std::endl;
+    }
+}
+
 int main(int argc, char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
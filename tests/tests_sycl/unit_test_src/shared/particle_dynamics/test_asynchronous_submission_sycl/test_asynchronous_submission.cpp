@@ -0,0 +1,83 @@
+#include "base_configuration_dynamics.h"
+#include "particle_functors.h"
+#include "particle_iterators_sycl.h"
+#include "sphinxsys_variable_sycl.hpp"
+
+#include <gtest/gtest.h>
+using namespace SPH;
+
+UnsignedInt data_size = 100003;
+
+/** A chain of dependent kernels, each reading the result of the previous one. */
+StdVec<UnsignedInt> runKernelChain(bool is_asynchronous)
+{
+    execution::execution_instance.setAsynchronous(is_asynchronous);
+    UnsignedInt *device_data = allocateDeviceOnly<UnsignedInt>(data_size);
+    UnsignedInt *device_offset = allocateDeviceOnly<UnsignedInt>(data_size);
+
+    particle_for(ParallelDevicePolicy{}, IndexRange(0, data_size), [=](size_t i)
+                 { device_data[i] = i % 7; });
+    for (size_t k = 0; k != 10; ++k)
+    {
+        particle_for(ParallelDevicePolicy{}, IndexRange(0, data_size), [=](size_t i)
+                     { device_data[i] = device_data[i] * 3 % 11 + 1; });
+    }
+    exclusive_scan(ParallelDevicePolicy{}, device_data, device_offset, data_size,
+                   PlusUnsignedInt<ParallelDevicePolicy>::type());
+    particle_for(ParallelDevicePolicy{}, IndexRange(0, data_size), [=](size_t i)
+                 { device_data[i] += device_offset[i]; });
+    UnsignedInt maximum = particle_reduce(ParallelDevicePolicy{}, IndexRange(0, data_size), UnsignedInt(0),
+                                          sycl::maximum<UnsignedInt>(), [=](size_t i)
+                                          { return device_data[i]; });
+
+    StdVec<UnsignedInt> result(data_size, 0);
+    copyFromDevice(result.data(), device_data, data_size);
+    freeDeviceData(device_data);
+    freeDeviceData(device_offset);
+    execution::execution_instance.setAsynchronous(false);
+
+    EXPECT_EQ(maximum, *std::max_element(result.begin(), result.end()));
+    return result;
+}
+
+TEST(asynchronous_submission, test_sycl)
+{
+    StdVec<UnsignedInt> synchronous_result = runKernelChain(false);
+    StdVec<UnsignedInt> asynchronous_result = runKernelChain(true);
+    EXPECT_EQ(synchronous_result, asynchronous_result);
+}
+
+/** The host access to a device-shared singular variable waits for the kernels still using it. */
+TEST(asynchronous_submission, test_device_shared_singular_variable)
+{
+    execution::execution_instance.setAsynchronous(true);
+    SingularVariable<UnsignedInt> sv_counter("Counter", 0);
+    UnsignedInt *counter = sv_counter.DelegatedData(ParallelDevicePolicy{});
+    UnsignedInt *device_data = allocateDeviceOnly<UnsignedInt>(data_size);
+
+    particle_for(ParallelDevicePolicy{}, IndexRange(0, data_size), [=](size_t i)
+                 { device_data[i] = i % 7; });
+    for (size_t k = 0; k != 10; ++k)
+    {
+        particle_for(ParallelDevicePolicy{}, IndexRange(0, data_size), [=](size_t i)
+                     { device_data[i] = device_data[i] * 3 % 11 + 1; });
+    }
+    particle_for(ParallelDevicePolicy{}, IndexRange(0, 1), [=](size_t i)
+                 { *counter = device_data[data_size - 1]; });
+    // the host increment should be applied after the value written by the last kernel
+    sv_counter.incrementValue(100);
+    UnsignedInt counter_value = sv_counter.getValue();
+
+    StdVec<UnsignedInt> result(data_size, 0);
+    copyFromDevice(result.data(), device_data, data_size);
+    freeDeviceData(device_data);
+    execution::execution_instance.setAsynchronous(false);
+
+    EXPECT_EQ(counter_value, result[data_size - 1] + 100);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+/**
+ * @file 	test_image_paging.cpp
+ * @brief 	test that an image paged from its raw file, with parallel queries
+ *          and with the reloaded signed-distance precompute, gives the same
+ *          results as the fully loaded image.
+ * @author 	Xiangyu Hu
+ */
+#include "image_mhd.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iterator>
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	The sphere is large enough for blocks entirely inside and outside.
+//----------------------------------------------------------------------
+Real radius = 28.0;
+Array3i number_of_cells(64, 64, 64);
+size_t paging_memory_budget = sizeof(float) * 64 * 64 * 3;
+
+std::string readFile(const std::string &file_name)
+{
+    std::ifstream file(file_name, std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+size_t countMismatches(ImageMHD<float, 3> &loaded, ImageMHD<float, 3> &paged)
+{
+    std::atomic<size_t> mismatches(0);
+    int number_of_probes = 40;
+    Real probe_spacing = 72.0 / Real(number_of_probes);
+    parallel_for(
+        IndexRange(0, number_of_probes * number_of_probes * number_of_probes),
+        [&](const IndexRange &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                Vec3d probe_point = Vec3d(n % number_of_probes, (n / number_of_probes) % number_of_probes,
+                                          n / (number_of_probes * number_of_probes)) *
+                                        probe_spacing -
+                                    36.0 * Vec3d::Ones();
+                if (loaded.findValueAtPoint(probe_point) != paged.findValueAtPoint(probe_point) ||
+                    loaded.findNormalAtPoint(probe_point) != paged.findNormalAtPoint(probe_point) ||
+                    loaded.findClosestPoint(probe_point) != paged.findClosestPoint(probe_point) ||
+                    loaded.checkContain(probe_point, true) != paged.checkContain(probe_point, true) ||
+                    loaded.checkContain(probe_point, false) != paged.checkContain(probe_point, false))
+                {
+                    mismatches++;
+                }
+            }
+        },
+        ap);
+    return mismatches;
+}
+
+TEST(ImageMHD, PagedSameAsLoaded)
+{
+    ImageMHD<float, 3> sphere(radius, number_of_cells, Vec3d::Ones()); // writes sphere.mhd
+    ImageMHD<float, 3> loaded("./sphere.mhd");
+    ImageMHD<float, 3> paged("./sphere.mhd", paging_memory_budget);
+    EXPECT_FALSE(loaded.isPaged());
+    EXPECT_TRUE(paged.isPaged());
+    EXPECT_EQ(paged.get_size(), loaded.get_size());
+    EXPECT_EQ(paged.get_min_value(), loaded.get_min_value());
+    EXPECT_EQ(paged.get_max_value(), loaded.get_max_value());
+    EXPECT_EQ(countMismatches(loaded, paged), 0u);
+
+    //- the reload reuses the signed-distance precompute stored alongside the raw file
+    ImageMHD<float, 3> reloaded("./sphere.mhd", paging_memory_budget);
+    EXPECT_EQ(reloaded.get_min_value(), loaded.get_min_value());
+    EXPECT_EQ(reloaded.get_max_value(), loaded.get_max_value());
+    EXPECT_EQ(countMismatches(loaded, reloaded), 0u);
+
+    paged.write("sphere_paged");
+    EXPECT_EQ(readFile("sphere_paged.raw"), readFile("sphere.raw"));
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
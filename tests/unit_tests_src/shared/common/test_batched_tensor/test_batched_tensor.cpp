@@ -0,0 +1,92 @@
+#include "batched_tensor.h"
+#include "large_data_containers.h"
+#include "polar_decomposition_3x3.h"
+
+#include <gtest/gtest.h>
+using namespace SPH;
+
+/** deformation gradients with positive determinant, i.e. perturbed identities */
+StdVec<Matd> randomDeformationGradients(size_t size)
+{
+    StdVec<Matd> matrices(size);
+    for (size_t k = 0; k != size; ++k)
+        matrices[k] = Matd::Identity() + 0.3 * Matd::Random();
+    return matrices;
+}
+
+TEST(batched_tensor, test_products_and_inverse)
+{
+    size_t size = 3 * BatchLanes - 1; // the last block is partially filled
+    StdVec<Matd> A = randomDeformationGradients(size);
+    StdVec<Matd> B = randomDeformationGradients(size);
+    StdVec<Matd> C(size), D(size), E(size), inverse_T(size);
+
+    for (size_t begin = 0; begin < size; begin += BatchLanes)
+    {
+        int block_size = SMIN(size_t(BatchLanes), size - begin);
+        BatchedMatd<> a, b, c, d, e, a_inverse_T;
+        BatchedReal<> determinant, squared_norm;
+        a.load(A.data(), begin, block_size);
+        b.load(B.data(), begin, block_size);
+        batchedProduct(a, b, c);
+        batchedProductTransposed(a, b, d);
+        batchedTransposedProduct(a, b, e);
+        batchedInverseTranspose(a, a_inverse_T, determinant);
+        batchedSquaredNorm(a, squared_norm);
+        c.store(C.data(), begin, block_size);
+        d.store(D.data(), begin, block_size);
+        e.store(E.data(), begin, block_size);
+        a_inverse_T.store(inverse_T.data(), begin, block_size);
+
+        for (int l = 0; l != block_size; ++l)
+        {
+            EXPECT_NEAR(determinant[l], A[begin + l].determinant(), 1.0e-12);
+            EXPECT_NEAR(squared_norm[l], (A[begin + l] * A[begin + l].transpose()).trace(), 1.0e-12);
+        }
+    }
+
+    for (size_t k = 0; k != size; ++k)
+    {
+        EXPECT_LT((C[k] - A[k] * B[k]).norm(), 1.0e-12);
+        EXPECT_LT((D[k] - A[k] * B[k].transpose()).norm(), 1.0e-12);
+        EXPECT_LT((E[k] - A[k].transpose() * B[k]).norm(), 1.0e-12);
+        EXPECT_LT((inverse_T[k] - A[k].inverse().transpose()).norm(), 1.0e-10);
+    }
+}
+
+TEST(batched_tensor, test_polar_decomposition)
+{
+    size_t size = 4 * BatchLanes;
+    StdVec<Matd> A = randomDeformationGradients(size);
+    for (size_t begin = 0; begin < size; begin += BatchLanes)
+    {
+        BatchedMatd<> a, q, h;
+        a.load(A.data(), begin, BatchLanes);
+        batchedPolarDecomposition(a, q, h);
+        for (int l = 0; l != BatchLanes; ++l)
+        {
+            Matd Q = q.lane(l);
+            Matd H = h.lane(l);
+            EXPECT_LT((Q * Q.transpose() - Matd::Identity()).norm(), 1.0e-10);
+            EXPECT_LT((Q * H - A[begin + l]).norm(), 1.0e-10);
+            EXPECT_LT((H - H.transpose()).norm(), 1.0e-12);
+            EXPECT_GT(H.determinant(), 0.0);
+
+            // compare with the per-particle decomposition
+            Real Q_ref[9], H_ref[9], A_ref[9];
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    A_ref[i * 3 + j] = A[begin + l](i, j);
+            polar::polar_decomposition(Q_ref, H_ref, A_ref);
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    EXPECT_NEAR(Q(i, j), Q_ref[i * 3 + j], 1.0e-8);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
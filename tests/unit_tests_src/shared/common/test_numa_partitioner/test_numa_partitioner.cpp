@@ -0,0 +1,89 @@
+#include "numa_partitioner.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace SPH;
+
+void checkEachIndexVisitedOnce(size_t size)
+{
+    StdVec<std::atomic<int>> visits(size);
+    for (auto &visit : visits)
+        visit = 0;
+
+    partitioned_parallel_for(
+        IndexRange(0, size),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+                visits[i]++;
+        });
+
+    for (size_t i = 0; i != size; ++i)
+        EXPECT_EQ(visits[i], 1);
+}
+
+TEST(numa_partitioner, default_partitioning)
+{
+    numa_partitioner.setActive(false);
+    checkEachIndexVisitedOnce(1);
+    checkEachIndexVisitedOnce(100003);
+}
+
+TEST(numa_partitioner, numa_affine_partitioning)
+{
+    // falls back to the default partitioning on a single NUMA node
+    numa_partitioner.setActive(true);
+    EXPECT_EQ(numa_partitioner.isActive(), numa_partitioner.NumberOfNodes() > 1);
+    checkEachIndexVisitedOnce(1);
+    checkEachIndexVisitedOnce(100003);
+    numa_partitioner.setActive(false);
+}
+
+TEST(numa_partitioner, first_touch_initialization)
+{
+    // sequential, as the initialization functions need not be thread safe by default
+    numa_partitioner.setActive(false);
+    size_t size = 100003;
+    size_t number_of_calls = 0;
+    size_t number_of_visits = 0;
+    first_touch_for(
+        IndexRange(0, size),
+        [&](const IndexRange &r)
+        {
+            number_of_calls++;
+            for (size_t i = r.begin(); i != r.end(); ++i)
+                number_of_visits++;
+        });
+    EXPECT_EQ(number_of_calls, 1);
+    EXPECT_EQ(number_of_visits, size);
+}
+
+TEST(numa_partitioner, nested_loops)
+{
+    numa_partitioner.setActive(true);
+    size_t outer_size = 64;
+    size_t inner_size = 1000;
+    std::atomic<size_t> total_visits(0);
+    partitioned_parallel_for(
+        IndexRange(0, outer_size),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                partitioned_parallel_for(
+                    IndexRange(0, inner_size),
+                    [&](const IndexRange &inner_r)
+                    { total_visits += inner_r.size(); });
+            }
+        });
+    EXPECT_EQ(total_visits, outer_size * inner_size);
+    numa_partitioner.setActive(false);
+}
+//=================================================================================================//
+//=================================================================================================//
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
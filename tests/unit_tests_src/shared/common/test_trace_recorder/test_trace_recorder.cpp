@@ -0,0 +1,51 @@
+#include "trace_recorder.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+using namespace SPH;
+
+/** names of CK dynamics are long and often differ only at their end */
+std::string longName(const std::string &ending)
+{
+    return "InteractionDynamicsCK<ParallelPolicy, Integration1stHalfCK<Inner<>, "
+           "NoKernelCorrectionCK, AcousticRiemannSolverCK, "
+           + ending + ">>@WaterBody";
+}
+
+TEST(trace_recorder, test_name_interning)
+{
+    std::string name_a = longName("LinearGradientCorrection");
+    std::string name_b = longName("NoLimiter");
+    size_t index_a = trace_recorder.internName(name_a);
+    size_t index_b = trace_recorder.internName(name_b);
+    EXPECT_NE(index_a, index_b);
+    EXPECT_EQ(index_a, trace_recorder.internName(name_a));
+    EXPECT_EQ(trace_recorder.Name(index_a), name_a);
+    EXPECT_EQ(trace_recorder.Name(index_b), name_b);
+
+    const char *literal = "particle_for";
+    size_t index_literal = trace_recorder.internName(literal);
+    EXPECT_EQ(index_literal, trace_recorder.internName(std::string(literal)));
+}
+
+TEST(trace_recorder, test_trace_file)
+{
+    std::string name_a = longName("LinearGradientCorrection");
+    std::string name_b = longName("NoLimiter");
+    trace_recorder.setActive(true);
+    {
+        TraceScope trace_scope_a(name_a);
+    }
+    {
+        TraceScope trace_scope_b(name_b);
+    }
+    trace_recorder.writeTraceFile();
+
+    std::ifstream trace_file("./sphinxsys_trace.json");
+    std::stringstream buffer;
+    buffer << trace_file.rdbuf();
+    std::string trace = buffer.str();
+    EXPECT_NE(trace.find("\"" + name_a + "\""), std::string::npos);
+    EXPECT_NE(trace.find("\"" + name_b + "\""), std::string::npos);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file 	2d_derived_output_variable.cpp
+ * @brief 	test that the output-only derived variables are written with the values
+ *          evaluated from their source variables, and that duplicated names are rejected.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+Vecd velocity(const Vecd &position) { return Vecd(sin(Pi * position[1] / DH), position[0] * position[1] - 0.1); }
+//----------------------------------------------------------------------
+//	Output-only variables derived from the velocity.
+//----------------------------------------------------------------------
+class KineticEnergyDensity : public DerivedOutputVariable<Real>
+{
+  public:
+    explicit KineticEnergyDensity(SPHBody &sph_body)
+        : DerivedOutputVariable<Real>("KineticEnergyDensity"),
+          dv_vel_(addSourceVariable(sph_body.getBaseParticles().getVariableByName<Vecd>("Velocity"))),
+          vel_(nullptr){};
+    virtual void setupOutput() override { vel_ = dv_vel_->DataField(); };
+    virtual Real evaluate(size_t index_i) override { return 0.5 * vel_[index_i].squaredNorm(); };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_vel_;
+    Vecd *vel_;
+};
+
+class VelocityDirection : public DerivedOutputVariable<Vecd>
+{
+  public:
+    explicit VelocityDirection(SPHBody &sph_body)
+        : DerivedOutputVariable<Vecd>("VelocityDirection"),
+          dv_vel_(addSourceVariable(sph_body.getBaseParticles().getVariableByName<Vecd>("Velocity"))),
+          vel_(nullptr){};
+    virtual void setupOutput() override { vel_ = dv_vel_->DataField(); };
+    virtual Vecd evaluate(size_t index_i) override { return vel_[index_i].normalized(); };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_vel_;
+    Vecd *vel_;
+};
+//----------------------------------------------------------------------
+//	Columns of a written plt file by their names.
+//----------------------------------------------------------------------
+StdVec<std::string> readColumnNames(std::ifstream &in_file)
+{
+    std::string header;
+    std::getline(in_file, header);
+    StdVec<std::string> names;
+    for (size_t begin = header.find('"'); begin != std::string::npos; begin = header.find('"', begin + 1))
+    {
+        size_t end = header.find('"', begin + 1);
+        names.push_back(header.substr(begin + 1, end - begin - 1));
+        begin = end;
+    }
+    return names;
+}
+
+TEST(DerivedOutputVariable, WrittenAsEvaluated)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    particles.registerStateVariable<Vecd>("Velocity", [&](size_t i) -> Vecd
+                                          { return velocity(pos[i]); });
+
+    BodyStatesRecordingToPlt body_states_recording(sph_system);
+    body_states_recording.addToWrite<Vecd>(block, "Velocity");
+    body_states_recording.addDerivedVariableToWrite<KineticEnergyDensity>(block);
+    body_states_recording.addDerivedVariableToWrite<VelocityDirection>(block);
+
+    // the source variables are staged from device together with those to write
+    DerivedOutputVariables &derived_variables = particles.DerivedVariablesToWrite();
+    for (DerivedOutputVariable<Real> *variable : std::get<DataTypeIndex<Real>::value>(derived_variables))
+    {
+        ASSERT_EQ(std::get<DataTypeIndex<Vecd>::value>(variable->SourceVariables()).size(), 1u);
+        EXPECT_EQ(std::get<DataTypeIndex<Vecd>::value>(variable->SourceVariables())[0]->Name(), "Velocity");
+    }
+
+    body_states_recording.writeToFile(0);
+    std::ifstream in_file(sph_system.getIOEnvironment().output_folder_ + "/SPHBody_Block_0000000000.plt");
+    StdVec<std::string> names = readColumnNames(in_file);
+    auto column = [&](const std::string &name)
+    { return std::find(names.begin(), names.end(), name) - names.begin(); };
+    ASSERT_LT(column("KineticEnergyDensity"), names.size());
+    ASSERT_LT(column("VelocityDirection_y"), names.size());
+
+    size_t number_of_rows = 0;
+    std::string line;
+    while (std::getline(in_file, line) && !line.empty())
+    {
+        std::stringstream row(line);
+        StdVec<Real> values;
+        for (Real value; row >> value;)
+            values.push_back(value);
+        ASSERT_EQ(values.size(), names.size());
+        size_t index_i = size_t(values[column("ID")]);
+        Vecd expected_velocity = velocity(pos[index_i]);
+        EXPECT_NEAR(values[column("KineticEnergyDensity")], 0.5 * expected_velocity.squaredNorm(), 1.0e-5);
+        EXPECT_NEAR(values[column("VelocityDirection_x")], expected_velocity.normalized()[0], 1.0e-5);
+        EXPECT_NEAR(values[column("VelocityDirection_y")], expected_velocity.normalized()[1], 1.0e-5);
+        number_of_rows++;
+    }
+    EXPECT_EQ(number_of_rows, particles.TotalRealParticles());
+}
+
+TEST(DerivedOutputVariable, DuplicatedNamesRejected)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    particles.registerStateVariable<Vecd>("Velocity");
+    particles.registerStateVariable<Real>("KineticEnergyDensity");
+
+    BodyStatesRecordingToPlt body_states_recording(sph_system);
+    body_states_recording.addDerivedVariableToWrite<VelocityDirection>(block);
+    EXPECT_EXIT(body_states_recording.addDerivedVariableToWrite<VelocityDirection>(block),
+                testing::ExitedWithCode(1), "");
+    EXPECT_EXIT(body_states_recording.addToWrite<Vecd>(block, "VelocityDirection"),
+                testing::ExitedWithCode(1), "");
+
+    body_states_recording.addToWrite<Real>(block, "KineticEnergyDensity");
+    EXPECT_EXIT(body_states_recording.addDerivedVariableToWrite<KineticEnergyDensity>(block),
+                testing::ExitedWithCode(1), "");
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
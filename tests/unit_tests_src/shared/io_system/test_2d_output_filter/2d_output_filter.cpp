@@ -0,0 +1,146 @@
+/**
+ * @file 	2d_output_filter.cpp
+ * @brief 	test that the body states recordings write exactly the particles selected
+ *          by all output filters of a body, in index order, and all particles of a body without filters,
+ *          and that the filters keep the variables they select by as source variables.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.025;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+BoundingBox filter_box(Vecd(0.0, 0.0), Vecd(0.5, 0.3));
+UnsignedInt stride = 3;
+
+IndexVector expectedParticles(BaseParticles &particles, bool is_filtered)
+{
+    Vecd *pos = particles.ParticlePositions();
+    UnsignedInt *original_id = particles.ParticleOriginalIds();
+    IndexVector expected;
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        if (!is_filtered || (filter_box.checkContain(pos[i]) && original_id[i] % stride == 0))
+            expected.push_back(i);
+    }
+    return expected;
+}
+
+IndexVector readPltParticles(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath);
+    std::string line;
+    std::getline(in_file, line); // header with x, y, z and ID first
+    IndexVector written;
+    while (std::getline(in_file, line) && !line.empty())
+    {
+        std::stringstream row(line);
+        Real x, y, z, id;
+        row >> x >> y >> z >> id;
+        written.push_back(size_t(id));
+    }
+    return written;
+}
+
+IndexVector readVtpParticles(const std::string &filefullpath, size_t &number_of_points)
+{
+    std::ifstream in_file(filefullpath);
+    std::string line;
+    IndexVector written;
+    while (std::getline(in_file, line))
+    {
+        size_t found = line.find("NumberOfPoints=\"");
+        if (found != std::string::npos)
+            number_of_points = std::stoul(line.substr(found + 16));
+        if (line.find("Name=\"SortedParticle_ID\"") != std::string::npos)
+        {
+            std::getline(in_file, line);
+            std::stringstream ids(line);
+            for (size_t id; ids >> id;)
+                written.push_back(id);
+        }
+    }
+    return written;
+}
+
+TEST(OutputFilter, WrittenParticlesSelectedByAllFilters)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    RealBody plate(sph_system, makeShared<Block>("Plate"));
+    plate.defineMaterial<Solid>();
+    plate.generateParticles<BaseParticles, Lattice>();
+    std::string output_folder = sph_system.getIOEnvironment().output_folder_;
+
+    BodyStatesRecordingToPlt write_plt(sph_system);
+    BodyStatesRecordingToVtp write_vtp(sph_system);
+    write_plt.addOutputFilter<OutputFilterInBox>(block, filter_box);
+    write_plt.addOutputFilter<OutputFilterStride>(block, stride);
+    write_vtp.addOutputFilter<OutputFilterInBox>(block, filter_box);
+    write_vtp.addOutputFilter<OutputFilterStride>(block, stride);
+
+    // the variables the filters select by are staged from device before the selection
+    OutputFilterStride stride_filter(block, stride);
+    ASSERT_EQ(std::get<DataTypeIndex<UnsignedInt>::value>(stride_filter.SourceVariables()).size(), 1u);
+    EXPECT_EQ(std::get<DataTypeIndex<UnsignedInt>::value>(stride_filter.SourceVariables())[0]->Name(), "OriginalID");
+    auto is_positive = [](Real value)
+    { return value > 0.0; };
+    OutputFilterByVariable<Real, decltype(is_positive)> variable_filter(block, "VolumetricMeasure", is_positive);
+    ASSERT_EQ(std::get<DataTypeIndex<Real>::value>(variable_filter.SourceVariables()).size(), 1u);
+    EXPECT_EQ(std::get<DataTypeIndex<Real>::value>(variable_filter.SourceVariables())[0]->Name(), "VolumetricMeasure");
+
+    Vecd *pos = block.getBaseParticles().ParticlePositions();
+    for (size_t frame = 0; frame != 2; ++frame)
+    {
+        // the selection follows the particles moving in and out of the box
+        if (frame != 0)
+        {
+            for (size_t i = 0; i != block.getBaseParticles().TotalRealParticles(); ++i)
+                pos[i][0] += 0.2;
+        }
+        block.setNewlyUpdated();
+        plate.setNewlyUpdated();
+        write_plt.writeToFile(frame);
+        block.setNewlyUpdated();
+        plate.setNewlyUpdated();
+        write_vtp.writeToFile(frame);
+
+        std::string sequence = std::string(9, '0') + std::to_string(frame);
+        IndexVector expected_block = expectedParticles(block.getBaseParticles(), true);
+        ASSERT_FALSE(expected_block.empty());
+        EXPECT_EQ(readPltParticles(output_folder + "/SPHBody_Block_" + sequence + ".plt"), expected_block);
+        size_t number_of_points = 0;
+        EXPECT_EQ(readVtpParticles(output_folder + "/Block_" + sequence + ".vtp", number_of_points), expected_block);
+        EXPECT_EQ(number_of_points, expected_block.size());
+
+        IndexVector expected_plate = expectedParticles(plate.getBaseParticles(), false);
+        EXPECT_EQ(readPltParticles(output_folder + "/SPHBody_Plate_" + sequence + ".plt"), expected_plate);
+        EXPECT_EQ(readVtpParticles(output_folder + "/Plate_" + sequence + ".vtp", number_of_points), expected_plate);
+        EXPECT_EQ(number_of_points, expected_plate.size());
+    }
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,108 @@
+/**
+ * @file 	2d_quantity_recording_buffer.cpp
+ * @brief 	test that the buffered quantity recording writes the same file as
+ *          the unbuffered record-by-record writing, and that the rows are flushed
+ *          at the bounded intervals and at destruction.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Recorded data with small, large and negative values.
+//----------------------------------------------------------------------
+size_t number_of_rows = 53;
+Real runTime(size_t row) { return 1.234567e-5 + 0.37 * Real(row); }
+Real scalarQuantity(size_t row) { return -1.0e3 * sin(Real(row)); }
+Vecd vectorQuantity(size_t row) { return Vecd(cos(Real(row)), 1.0e-7 * Real(row)); }
+
+std::string readFile(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath.c_str());
+    std::stringstream content;
+    content << in_file.rdbuf();
+    return content.str();
+}
+
+void writeUnbuffered(const std::string &filefullpath)
+{
+    PltEngine plt_engine;
+    for (size_t row = 0; row != number_of_rows; ++row)
+    {
+        std::ofstream out_file(filefullpath.c_str(), std::ios::app);
+        out_file << runTime(row) << "   ";
+        plt_engine.writeAQuantity(out_file, scalarQuantity(row));
+        plt_engine.writeAQuantity(out_file, vectorQuantity(row));
+        out_file << "\n";
+        out_file.close();
+    }
+}
+
+void recordRow(QuantityRecordingBuffer &recording_buffer, size_t row)
+{
+    recording_buffer.startRow(runTime(row));
+    recording_buffer.appendQuantity(scalarQuantity(row));
+    recording_buffer.appendQuantity(vectorQuantity(row));
+    recording_buffer.closeRow();
+}
+
+TEST(QuantityRecordingBuffer, SameAsUnbuffered)
+{
+    std::string unbuffered_file = "./unbuffered.dat";
+    fs::remove(unbuffered_file);
+    writeUnbuffered(unbuffered_file);
+    std::string reference = readFile(unbuffered_file);
+    ASSERT_FALSE(reference.empty());
+
+    for (size_t flush_interval : {1, 7, 100})
+    {
+        std::string buffered_file = "./buffered_" + std::to_string(flush_interval) + ".dat";
+        fs::remove(buffered_file);
+        {
+            QuantityRecordingBuffer recording_buffer(buffered_file, flush_interval);
+            for (size_t row = 0; row != number_of_rows; ++row)
+            {
+                recordRow(recording_buffer, row);
+            }
+        }
+        EXPECT_EQ(readFile(buffered_file), reference);
+    }
+}
+
+TEST(QuantityRecordingBuffer, BoundedFlush)
+{
+    std::string buffered_file = "./bounded.dat";
+    fs::remove(buffered_file);
+    {
+        // held in memory until the number of rows reaches the interval or at destruction
+        QuantityRecordingBuffer recording_buffer(buffered_file, 10, 1.0e6);
+        for (size_t row = 0; row != 9; ++row)
+        {
+            recordRow(recording_buffer, row);
+        }
+        EXPECT_TRUE(readFile(buffered_file).empty());
+        recordRow(recording_buffer, 9);
+        std::string content = readFile(buffered_file);
+        EXPECT_EQ(std::count(content.begin(), content.end(), '\n'), 10);
+        recordRow(recording_buffer, 10);
+    }
+    std::string content = readFile(buffered_file);
+    EXPECT_EQ(std::count(content.begin(), content.end(), '\n'), 11);
+
+    fs::remove(buffered_file);
+    {
+        // a row is flushed at once when the time interval has passed
+        QuantityRecordingBuffer recording_buffer(buffered_file, 100, 0.0);
+        recordRow(recording_buffer, 0);
+        content = readFile(buffered_file);
+        EXPECT_EQ(std::count(content.begin(), content.end(), '\n'), 1);
+    }
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
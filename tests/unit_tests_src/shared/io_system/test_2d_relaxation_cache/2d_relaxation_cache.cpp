@@ -0,0 +1,92 @@
+/**
+ * @file 	2d_relaxation_cache.cpp
+ * @brief 	test that the relaxation cache is found for the same shape, resolution
+ *          and relaxation parameters only, and that it reloads the cached particles.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+StdVec<Real> relaxation_parameters = {1000, 0.25};
+class Block : public ComplexShape
+{
+  public:
+    Block(const std::string &shape_name, Real length) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * length, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+
+TEST(ParticleRelaxationCache, HitMissAndKeyChange)
+{
+    //----------------------------------------------------------------------
+    //	Miss at the first run, the particles are written to the cache after relaxation.
+    //----------------------------------------------------------------------
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    fs::remove_all("./reload/relaxation_cache");
+    RealBody block(sph_system, makeShared<Block>("Block", DL));
+    block.defineMaterial<Solid>();
+    ParticleRelaxationCache relaxation_cache(block, relaxation_parameters);
+    EXPECT_FALSE(relaxation_cache.isCached());
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        pos[i] += 0.1 * particle_spacing * Vecd(sin(Real(i)), cos(Real(i)));
+    }
+    relaxation_cache.writeToFile();
+    EXPECT_TRUE(relaxation_cache.isCached());
+    //----------------------------------------------------------------------
+    //	Hit at a later run with the same setup, which reloads the cached particles.
+    //----------------------------------------------------------------------
+    SPHSystem later_system(system_domain_bounds, particle_spacing);
+    later_system.setIOEnvironment();
+    RealBody later_block(later_system, makeShared<Block>("Block", DL));
+    later_block.defineMaterial<Solid>();
+    ParticleRelaxationCache later_relaxation_cache(later_block, relaxation_parameters);
+    EXPECT_TRUE(later_relaxation_cache.isCached());
+    EXPECT_EQ(later_relaxation_cache.ReloadName(), relaxation_cache.ReloadName());
+    later_block.generateParticles<BaseParticles, Reload>(later_relaxation_cache.ReloadName());
+    BaseParticles &later_particles = later_block.getBaseParticles();
+    Vecd *later_pos = later_particles.ParticlePositions();
+    ASSERT_EQ(later_particles.TotalRealParticles(), particles.TotalRealParticles());
+    for (size_t i = 0; i != later_particles.TotalRealParticles(); ++i)
+    {
+        EXPECT_LT((later_pos[i] - pos[i]).norm(), 1.0e-6);
+    }
+    //----------------------------------------------------------------------
+    //	Miss when the relaxation parameters, the shape or the resolution are changed.
+    //----------------------------------------------------------------------
+    ParticleRelaxationCache changed_parameters_cache(later_block, {2000, 0.25});
+    EXPECT_FALSE(changed_parameters_cache.isCached());
+
+    SPHSystem changed_shape_system(system_domain_bounds, particle_spacing);
+    changed_shape_system.setIOEnvironment();
+    RealBody changed_shape_block(changed_shape_system, makeShared<Block>("Block", 0.8 * DL));
+    ParticleRelaxationCache changed_shape_cache(changed_shape_block, relaxation_parameters);
+    EXPECT_FALSE(changed_shape_cache.isCached());
+
+    SPHSystem changed_resolution_system(system_domain_bounds, 0.5 * particle_spacing);
+    changed_resolution_system.setIOEnvironment();
+    RealBody changed_resolution_block(changed_resolution_system, makeShared<Block>("Block", DL));
+    ParticleRelaxationCache changed_resolution_cache(changed_resolution_block, relaxation_parameters);
+    EXPECT_FALSE(changed_resolution_cache.isCached());
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
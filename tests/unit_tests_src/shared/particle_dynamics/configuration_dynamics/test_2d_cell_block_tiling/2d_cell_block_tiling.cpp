@@ -0,0 +1,232 @@
+/**
+ * @file 	2d_cell_block_tiling.cpp
+ * @brief 	test that the tiled execution from the staged tile data visits each real particle once
+ *          and gives the same result as the flat particle loop, that the kernels specialized
+ *          for other execution policies still run in flat particle order
+ *          and that the tiling is not used together with skipping the sleeping particles.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	Count the visits of each particle by its original id,
+//	which are recorded outside of the staged particle data.
+//----------------------------------------------------------------------
+template <typename... T>
+class VisitCount;
+
+template <typename... Parameters>
+class VisitCount<Inner<Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    VisitCount(Relation<Inner<Parameters...>> &inner_relation, std::atomic<UnsignedInt> *visit_count)
+        : BaseInteraction(inner_relation),
+          dv_original_id_(this->particles_->template getVariableByName<UnsignedInt>("OriginalID")),
+          visit_count_(visit_count){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseInteraction::InteractKernel(ex_policy, encloser),
+              original_id_(encloser.dv_original_id_->DelegatedDataField(ex_policy)),
+              visit_count_(encloser.visit_count_){};
+        void interact(size_t index_i, Real dt = 0.0) { visit_count_[original_id_[index_i]]++; };
+
+      protected:
+        UnsignedInt *original_id_;
+        std::atomic<UnsignedInt> *visit_count_;
+    };
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_original_id_;
+    std::atomic<UnsignedInt> *visit_count_;
+};
+//----------------------------------------------------------------------
+//	Kernel gradient and relative velocity sums over the neighbors,
+//	which read the positions, volumes and velocities of the neighbors.
+//----------------------------------------------------------------------
+template <typename... T>
+class NeighborSum;
+
+template <typename... Parameters>
+class NeighborSum<Inner<Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit NeighborSum(Relation<Inner<Parameters...>> &inner_relation)
+        : BaseInteraction(inner_relation),
+          dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
+          dv_vel_(this->particles_->template registerStateVariableOnly<Vecd>("Velocity")),
+          dv_kernel_gradient_sum_(this->particles_->template registerStateVariableOnly<Vecd>("KernelGradientSum")),
+          dv_relative_velocity_sum_(this->particles_->template registerStateVariableOnly<Vecd>("RelativeVelocitySum")){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseInteraction::InteractKernel(ex_policy, encloser),
+              Vol_(encloser.dv_Vol_->DelegatedDataField(ex_policy)),
+              vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)),
+              kernel_gradient_sum_(encloser.dv_kernel_gradient_sum_->DelegatedDataField(ex_policy)),
+              relative_velocity_sum_(encloser.dv_relative_velocity_sum_->DelegatedDataField(ex_policy)){};
+        void interact(size_t index_i, Real dt = 0.0)
+        {
+            Vecd kernel_gradient_sum = Vecd::Zero();
+            Vecd relative_velocity_sum = Vecd::Zero();
+            for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+            {
+                UnsignedInt index_j = this->neighbor_index_[n];
+                kernel_gradient_sum += this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
+                relative_velocity_sum += vel_[index_i] - vel_[index_j];
+            }
+            kernel_gradient_sum_[index_i] = kernel_gradient_sum;
+            relative_velocity_sum_[index_i] = relative_velocity_sum;
+        };
+
+      protected:
+        Real *Vol_;
+        Vecd *vel_, *kernel_gradient_sum_, *relative_velocity_sum_;
+    };
+
+  protected:
+    DiscreteVariable<Real> *dv_Vol_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_kernel_gradient_sum_, *dv_relative_velocity_sum_;
+};
+
+//----------------------------------------------------------------------
+//	Neighbor count with a kernel created for the parallel policy only.
+//----------------------------------------------------------------------
+template <typename... T>
+class HostNeighborCount;
+
+template <typename... Parameters>
+class HostNeighborCount<Inner<Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit HostNeighborCount(Relation<Inner<Parameters...>> &inner_relation)
+        : BaseInteraction(inner_relation),
+          dv_neighbor_count_(this->particles_->template registerDiscreteVariableOnly<UnsignedInt>(
+              "NeighborCount", this->particles_->ParticlesBound())){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class EncloserType>
+        InteractKernel(const execution::ParallelPolicy &par, EncloserType &encloser)
+            : BaseInteraction::InteractKernel(par, encloser),
+              neighbor_count_(encloser.dv_neighbor_count_->DelegatedDataField(par)){};
+        void interact(size_t index_i, Real dt = 0.0)
+        {
+            neighbor_count_[index_i] = this->LastNeighbor(index_i) - this->FirstNeighbor(index_i);
+        };
+
+      protected:
+        UnsignedInt *neighbor_count_;
+    };
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_neighbor_count_;
+};
+
+TEST(CellBlockTiling, SameResultAsFlatLoop)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    particles.registerStateVariable<Vecd>(
+        "Velocity", [&](size_t i) -> Vecd
+        { return Vecd(sin(Pi * pos[i][1] / DH), pos[i][0] * pos[i][1]); });
+    particles.registerStateVariable<Vecd>("KernelGradientSum");
+    particles.registerStateVariable<Vecd>("RelativeVelocitySum");
+    size_t total_real_particles = particles.TotalRealParticles();
+    std::unique_ptr<std::atomic<UnsignedInt>[]> visit_count(new std::atomic<UnsignedInt>[total_real_particles]);
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> block_cell_linked_list(block);
+    Relation<Inner<>> block_inner(block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_block_inner(block_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, NeighborSum<Inner<>>> flat_neighbor_sum(block_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, NeighborSum<Inner<>>> tiled_neighbor_sum(block_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, VisitCount<Inner<>>> tiled_visit_count(block_inner, visit_count.get());
+
+    block_cell_linked_list.exec();
+    update_block_inner.exec();
+    flat_neighbor_sum.exec();
+    Vecd *kernel_gradient_sum = particles.getVariableDataByName<Vecd>("KernelGradientSum");
+    Vecd *relative_velocity_sum = particles.getVariableDataByName<Vecd>("RelativeVelocitySum");
+    StdVec<Vecd> reference_kernel_gradient_sum(kernel_gradient_sum, kernel_gradient_sum + total_real_particles);
+    StdVec<Vecd> reference_relative_velocity_sum(relative_velocity_sum, relative_velocity_sum + total_real_particles);
+
+    for (UnsignedInt tile_size : {1, 2, 4, 7})
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            visit_count[i] = 0;
+            kernel_gradient_sum[i] = Vecd::Zero();
+            relative_velocity_sum[i] = Vecd::Zero();
+        }
+        tiled_visit_count.useCellBlockTiles(tile_size);
+        tiled_visit_count.exec();
+        tiled_neighbor_sum.useCellBlockTiles(tile_size);
+        tiled_neighbor_sum.exec();
+
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            EXPECT_EQ(visit_count[i], 1u);
+            EXPECT_LT((kernel_gradient_sum[i] - reference_kernel_gradient_sum[i]).norm(), Eps);
+            EXPECT_LT((relative_velocity_sum[i] - reference_relative_velocity_sum[i]).norm(), Eps);
+        }
+    }
+
+    InteractionDynamicsCK<execution::ParallelPolicy, HostNeighborCount<Inner<>>> host_neighbor_count(block_inner);
+    host_neighbor_count.exec();
+    UnsignedInt *neighbor_count = particles.getVariableDataByName<UnsignedInt>("NeighborCount");
+    UnsignedInt *particle_offset = block_inner.getParticleOffset()->DataField();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_EQ(neighbor_count[i], particle_offset[i + 1] - particle_offset[i]);
+    }
+
+    particles.registerDiscreteVariableOnly<UnsignedInt>(
+        "AwakeParticleIndex", particles.ParticlesBound(), [&](size_t i) -> UnsignedInt
+        { return i; });
+    particles.registerSingularVariable<UnsignedInt>("TotalAwakeParticles", total_real_particles);
+    tiled_visit_count.skipSleepingParticles();
+    EXPECT_EXIT(tiled_visit_count.exec(), ::testing::ExitedWithCode(1), "");
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,100 @@
+/**
+ * @file 	2d_contact_bounding_box.cpp
+ * @brief 	test the particle bounds used by the broad phase of the contact relation
+ *          for bodies at negative coordinates.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//	All bodies are located at negative coordinates.
+//----------------------------------------------------------------------
+Real particle_spacing = 0.02;
+Vec2d block_halfsize(0.2, 0.2);
+Vec2d source_center(-1.0, -0.5);
+Vec2d near_center(-0.6, -0.5);
+Vec2d far_center(-2.5, -0.5);
+class Block : public ComplexShape
+{
+  public:
+    Block(const std::string &shape_name, const Vec2d &center) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(center), block_halfsize);
+    }
+};
+
+TEST(ContactBoundingBox, NegativeCoordinates)
+{
+    BoundingBox system_domain_bounds(Vec2d(-3.0, -1.0), Vec2d::Zero());
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    SolidBody source_block(sph_system, makeShared<Block>("SourceBlock", source_center));
+    source_block.defineMaterial<Solid>();
+    source_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody near_block(sph_system, makeShared<Block>("NearBlock", near_center));
+    near_block.defineMaterial<Solid>();
+    near_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody far_block(sph_system, makeShared<Block>("FarBlock", far_center));
+    far_block.defineMaterial<Solid>();
+    far_block.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	The reduced bounds are the exact bounds of the particles.
+    //----------------------------------------------------------------------
+    BaseParticles &source_particles = source_block.getBaseParticles();
+    size_t total_source_particles = source_particles.TotalRealParticles();
+    Vecd *source_pos = source_particles.ParticlePositions();
+    ReduceBoundingBox reduce_bounding_box;
+    BoundingBox reduced_bounds =
+        particle_reduce(execution::ParallelPolicy(), IndexRange(0, total_source_particles),
+                        reduce_bounding_box.reference_, reduce_bounding_box,
+                        [&](size_t index_i)
+                        { return BoundingBox(source_pos[index_i], source_pos[index_i]); });
+    Vecd lower_bound = source_pos[0];
+    Vecd upper_bound = source_pos[0];
+    for (size_t i = 0; i != total_source_particles; ++i)
+    {
+        lower_bound = lower_bound.cwiseMin(source_pos[i]);
+        upper_bound = upper_bound.cwiseMax(source_pos[i]);
+    }
+    EXPECT_LT(upper_bound[0], 0.0);
+    EXPECT_LT(upper_bound[1], 0.0);
+    EXPECT_EQ(reduced_bounds.first_, lower_bound);
+    EXPECT_EQ(reduced_bounds.second_, upper_bound);
+    //----------------------------------------------------------------------
+    //	The contact neighbors found with the broad phase are the ones found by brute force.
+    //----------------------------------------------------------------------
+    ContactRelation source_contact(source_block, {&near_block, &far_block});
+    sph_system.initializeSystemCellLinkedLists();
+    source_contact.updateConfiguration();
+
+    Real cutoff_radius = source_block.sph_adaptation_->getKernel()->CutOffRadius();
+    StdVec<SolidBody *> contact_blocks = {&near_block, &far_block};
+    size_t total_contact_neighbors = 0;
+    for (size_t k = 0; k != contact_blocks.size(); ++k)
+    {
+        BaseParticles &contact_particles = contact_blocks[k]->getBaseParticles();
+        Vecd *contact_pos = contact_particles.ParticlePositions();
+        for (size_t i = 0; i != total_source_particles; ++i)
+        {
+            size_t brute_force_neighbors = 0;
+            for (size_t j = 0; j != contact_particles.TotalRealParticles(); ++j)
+            {
+                if ((source_pos[i] - contact_pos[j]).norm() < cutoff_radius)
+                    brute_force_neighbors++;
+            }
+            EXPECT_EQ(source_contact.contact_configuration_[k][i].current_size_, brute_force_neighbors);
+            total_contact_neighbors += brute_force_neighbors;
+        }
+    }
+    EXPECT_GT(total_contact_neighbors, 0u);
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
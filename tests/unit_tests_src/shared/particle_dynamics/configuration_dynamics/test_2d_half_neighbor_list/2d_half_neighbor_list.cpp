@@ -0,0 +1,115 @@
+/**
+ * @file 	2d_half_neighbor_list.cpp
+ * @brief 	test that the half neighbor list keeps each inner pair once
+ *          and that the coloured pair scatter visits every pair from both sides.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	Count the pairs of each particle by adding to both particles of a pair.
+//----------------------------------------------------------------------
+template <typename... T>
+class NeighborPairCount;
+
+template <typename... Parameters>
+class NeighborPairCount<Inner<Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit NeighborPairCount(Relation<Inner<Parameters...>> &inner_relation)
+        : BaseInteraction(inner_relation),
+          dv_pair_count_(this->particles_->template registerStateVariableOnly<int>("PairCount")){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseInteraction::InteractKernel(ex_policy, encloser),
+              pair_count_(encloser.dv_pair_count_->DelegatedDataField(ex_policy)){};
+        void interact(size_t index_i, Real dt = 0.0)
+        {
+            for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+            {
+                pair_count_[index_i] += 1;
+                pair_count_[this->neighbor_index_[n]] += 1;
+            }
+        };
+
+      protected:
+        int *pair_count_;
+    };
+
+  protected:
+    DiscreteVariable<int> *dv_pair_count_;
+};
+
+TEST(HalfNeighborList, PairsListedOnce)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> block_cell_linked_list(block);
+    Relation<Inner<>> block_inner(block);
+    Relation<Inner<HalfList>> block_half_inner(block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_block_inner(block_inner);
+    UpdateRelation<execution::ParallelPolicy, Inner<HalfList>> update_block_half_inner(block_half_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, NeighborPairCount<Inner<HalfList>>> neighbor_pair_count(block_half_inner);
+
+    block_cell_linked_list.exec();
+    update_block_inner.exec();
+    update_block_half_inner.exec();
+    neighbor_pair_count.exec();
+
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    UnsignedInt *neighbor_index = block_inner.getNeighborIndex()->DataField();
+    UnsignedInt *particle_offset = block_inner.getParticleOffset()->DataField();
+    UnsignedInt *half_neighbor_index = block_half_inner.getNeighborIndex()->DataField();
+    UnsignedInt *half_particle_offset = block_half_inner.getParticleOffset()->DataField();
+    int *pair_count = particles.getVariableDataByName<int>("PairCount");
+
+    EXPECT_GT(particle_offset[total_real_particles], 0);
+    EXPECT_EQ(2 * half_particle_offset[total_real_particles], particle_offset[total_real_particles]);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        for (UnsignedInt n = half_particle_offset[i]; n != half_particle_offset[i + 1]; ++n)
+        {
+            UnsignedInt j = half_neighbor_index[n];
+            EXPECT_GT(j, i);
+            EXPECT_NE(std::find(neighbor_index + particle_offset[i], neighbor_index + particle_offset[i + 1], j),
+                      neighbor_index + particle_offset[i + 1]);
+        }
+        EXPECT_EQ(UnsignedInt(pair_count[i]), particle_offset[i + 1] - particle_offset[i]);
+    }
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
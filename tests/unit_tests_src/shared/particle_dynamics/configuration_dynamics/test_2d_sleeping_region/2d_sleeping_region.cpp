@@ -0,0 +1,171 @@
+/**
+ * @file 	2d_sleeping_region.cpp
+ * @brief 	test that skipping the sleeping particles gives the same result as the full loop
+ *          while the sleeping particles are at rest, also after the particles are sorted.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+Real moving_region_width = 0.2;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	A particle is active if it is moving.
+//----------------------------------------------------------------------
+class MovingCriterion
+{
+  public:
+    explicit MovingCriterion(BaseParticles *particles)
+        : dv_vel_(particles->registerStateVariableOnly<Vecd>("Velocity")){};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, MovingCriterion &encloser)
+            : vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)){};
+        bool operator()(UnsignedInt index_i) { return vel_[index_i].squaredNorm() > Eps; };
+
+      protected:
+        Vecd *vel_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_vel_;
+};
+//----------------------------------------------------------------------
+//	Sum of the relative velocities of the neighbors, zero for a particle at rest
+//	with all neighbors at rest.
+//----------------------------------------------------------------------
+template <typename... T>
+class RelativeVelocitySum;
+
+template <typename... Parameters>
+class RelativeVelocitySum<Inner<Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit RelativeVelocitySum(Relation<Inner<Parameters...>> &inner_relation)
+        : BaseInteraction(inner_relation),
+          dv_vel_(this->particles_->template registerStateVariableOnly<Vecd>("Velocity")),
+          dv_relative_velocity_sum_(this->particles_->template registerStateVariableOnly<Vecd>("RelativeVelocitySum")){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseInteraction::InteractKernel(ex_policy, encloser),
+              vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)),
+              relative_velocity_sum_(encloser.dv_relative_velocity_sum_->DelegatedDataField(ex_policy)){};
+        void interact(size_t index_i, Real dt = 0.0)
+        {
+            Vecd relative_velocity_sum = Vecd::Zero();
+            for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+            {
+                relative_velocity_sum += vel_[index_i] - vel_[this->neighbor_index_[n]];
+            }
+            relative_velocity_sum_[index_i] = relative_velocity_sum;
+        };
+
+      protected:
+        Vecd *vel_;
+        Vecd *relative_velocity_sum_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_vel_;
+    DiscreteVariable<Vecd> *dv_relative_velocity_sum_;
+};
+
+TEST(SleepingRegion, SkippedLoopMatchesFullLoop)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    Vecd *initial_pos = particles.ParticlePositions();
+    particles.registerStateVariable<Vecd>(
+        "Velocity", [&](size_t i) -> Vecd
+        { return initial_pos[i][0] < moving_region_width ? Vecd(1.0, 0.0) : Vecd::Zero(); });
+    particles.registerStateVariable<Vecd>("RelativeVelocitySum");
+    particles.addVariableToSort<Vecd>("Position");
+    particles.addVariableToSort<Vecd>("Velocity");
+    particles.addVariableToSort<Vecd>("RelativeVelocitySum");
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> block_cell_linked_list(block);
+    Relation<Inner<>> block_inner(block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_block_inner(block_inner);
+    ParticleSortCK<execution::ParallelPolicy, RadixSort> particle_sort(block);
+    UpdateSleepingRegion<execution::ParallelPolicy, MovingCriterion> update_sleeping_region(block);
+    InteractionDynamicsCK<execution::ParallelPolicy, RelativeVelocitySum<Inner<>>> full_loop(block_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, RelativeVelocitySum<Inner<>>> skipped_loop(block_inner);
+    skipped_loop.skipSleepingParticles();
+    //----------------------------------------------------------------------
+    //	The reference result by the full loop, recorded by original ids.
+    //----------------------------------------------------------------------
+    block_cell_linked_list.exec();
+    update_block_inner.exec();
+    full_loop.exec();
+
+    size_t total_real_particles = particles.TotalRealParticles();
+    UnsignedInt *original_id = particles.ParticleOriginalIds();
+    Vecd *relative_velocity_sum = particles.getVariableDataByName<Vecd>("RelativeVelocitySum");
+    StdVec<Vecd> reference(total_real_particles);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        reference[original_id[i]] = relative_velocity_sum[i];
+    }
+    //----------------------------------------------------------------------
+    //	The sleeping region is updated before the particles are sorted,
+    //	and the skipped loop starts from the state at rest.
+    //----------------------------------------------------------------------
+    update_sleeping_region.exec();
+    particle_sort.exec();
+    block_cell_linked_list.exec();
+    update_block_inner.exec();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        relative_velocity_sum[i] = Vecd::Zero();
+    }
+    skipped_loop.exec();
+
+    UnsignedInt total_awake_particles =
+        particles.getSingularVariableByName<UnsignedInt>("TotalAwakeParticles")->getValue();
+    EXPECT_GT(total_awake_particles, 0u);
+    EXPECT_LT(total_awake_particles, total_real_particles);
+
+    bool is_sorted = false;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        is_sorted = is_sorted || original_id[i] != i;
+        EXPECT_LT((relative_velocity_sum[i] - reference[original_id[i]]).norm(), Eps);
+    }
+    EXPECT_TRUE(is_sorted);
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,65 @@
+#include "particle_sort_ck.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+using namespace SPH;
+
+template <class ExecutionPolicy>
+UnsignedInt testRadixSort(UnsignedInt data_size, UnsignedInt max_key)
+{
+    DiscreteVariable<UnsignedInt> dv_sequence("Sequence", data_size);
+    DiscreteVariable<UnsignedInt> dv_index_permutation("IndexPermutation", data_size);
+    UnsignedInt *sequence = dv_sequence.DataField();
+    UnsignedInt *index_permutation = dv_index_permutation.DataField();
+
+    std::mt19937 random_engine(data_size);
+    std::uniform_int_distribution<UnsignedInt> key_distribution(0, max_key);
+    StdVec<std::pair<UnsignedInt, UnsignedInt>> reference(data_size);
+    for (UnsignedInt i = 0; i != data_size; ++i)
+    {
+        sequence[i] = key_distribution(random_engine);
+        index_permutation[i] = i;
+        reference[i] = std::make_pair(sequence[i], i);
+    }
+    std::stable_sort(reference.begin(), reference.end(),
+                     [](const std::pair<UnsignedInt, UnsignedInt> &a, const std::pair<UnsignedInt, UnsignedInt> &b)
+                     { return a.first < b.first; });
+
+    RadixSort radix_sort(ExecutionPolicy{}, &dv_sequence, &dv_index_permutation);
+    radix_sort.sortByBlockedPasses(ExecutionPolicy{}, data_size);
+
+    for (UnsignedInt i = 0; i != data_size; ++i)
+    {
+        EXPECT_EQ(sequence[i], reference[i].first);
+        EXPECT_EQ(index_permutation[i], reference[i].second);
+    }
+    return radix_sort.ScatterPasses();
+}
+
+TEST(radix_sort, test_sequenced)
+{
+    testRadixSort<SequencedPolicy>(1000, 255);
+    testRadixSort<SequencedPolicy>(100000, 1 << 20);
+}
+
+TEST(radix_sort, test_tbb)
+{
+    testRadixSort<ParallelPolicy>(1, 7);
+    testRadixSort<ParallelPolicy>(100000, 0);
+    testRadixSort<ParallelPolicy>(300007, 1 << 20);
+    testRadixSort<ParallelPolicy>(300007, std::numeric_limits<UnsignedInt>::max());
+}
+
+TEST(radix_sort, test_skipped_passes)
+{
+    // the digits shared by all keys are found over several blocks
+    EXPECT_EQ(testRadixSort<ParallelPolicy>(100000, 0), 0u);
+    EXPECT_EQ(testRadixSort<ParallelPolicy>(100000, 255), 1u);
+    EXPECT_EQ(testRadixSort<SequencedPolicy>(100000, (1 << 16) - 1), 2u);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
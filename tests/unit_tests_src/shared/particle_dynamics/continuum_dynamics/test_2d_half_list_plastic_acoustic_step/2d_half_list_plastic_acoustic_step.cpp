@@ -0,0 +1,272 @@
+/**
+ * @file 	2d_half_list_plastic_acoustic_step.cpp
+ * @brief 	test that the plastic acoustic steps on the half neighbor list
+ *          give the same force, density change rate and velocity gradient as on the full list,
+ *          also when sleeping particles are skipped and wake up later.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 0.2;
+Real DH = 0.1;
+Real particle_spacing = 0.004;
+Real rho0_s = 2040;
+Real Youngs_modulus = 5.84e6;
+Real poisson = 0.3;
+Real c_s = sqrt(Youngs_modulus / (rho0_s * 3.0 * (1.0 - 2.0 * poisson)));
+Real friction_angle = 21.9 * Pi / 180;
+class Soil : public ComplexShape
+{
+  public:
+    explicit Soil(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+using FullListStep1stHalf = continuum_dynamics::PlasticAcousticStep1stHalf<
+    Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrection>>;
+using HalfListStep1stHalf = continuum_dynamics::PlasticAcousticStep1stHalf<
+    Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrection, HalfList>>;
+using FullListStep2ndHalf = continuum_dynamics::PlasticAcousticStep2ndHalf<
+    Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrection>>;
+using HalfListStep2ndHalf = continuum_dynamics::PlasticAcousticStep2ndHalf<
+    Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrection, HalfList>>;
+//----------------------------------------------------------------------
+//	Maximum relative difference of two particle fields.
+//----------------------------------------------------------------------
+template <typename DataType>
+Real maxRelativeDifference(const StdVec<DataType> &reference, DataType *data)
+{
+    Real max_value = 0.0;
+    Real max_difference = 0.0;
+    for (size_t i = 0; i != reference.size(); ++i)
+    {
+        max_value = SMAX(max_value, Real(getSquaredNorm(reference[i])));
+        max_difference = SMAX(max_difference, Real(getSquaredNorm(data[i] - reference[i])));
+    }
+    return sqrt(max_difference / max_value);
+}
+
+TEST(HalfListPlasticAcousticStep, SameResultAsFullList)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    RealBody soil_block(sph_system, makeShared<Soil>("Soil"));
+    soil_block.defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+    soil_block.generateParticles<BaseParticles, Lattice>();
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> soil_cell_linked_list(soil_block);
+    Relation<Inner<>> soil_inner(soil_block);
+    Relation<Inner<HalfList>> soil_half_inner(soil_block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_soil_inner(soil_inner);
+    UpdateRelation<execution::ParallelPolicy, Inner<HalfList>> update_soil_half_inner(soil_half_inner);
+    StateDynamics<execution::ParallelPolicy, fluid_dynamics::AdvectionStepSetup> soil_advection_step_setup(soil_block);
+    InteractionDynamicsCK<execution::ParallelPolicy, FullListStep1stHalf> full_list_1st_half(soil_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, HalfListStep1stHalf> half_list_1st_half(soil_half_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, FullListStep2ndHalf> full_list_2nd_half(soil_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, HalfListStep2ndHalf> half_list_2nd_half(soil_half_inner);
+    //----------------------------------------------------------------------
+    //	A smooth velocity and stress field.
+    //----------------------------------------------------------------------
+    BaseParticles &particles = soil_block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Vecd *vel = particles.getVariableDataByName<Vecd>("Velocity");
+    Vecd *force = particles.getVariableDataByName<Vecd>("Force");
+    Real *drho_dt = particles.getVariableDataByName<Real>("DensityChangeRate");
+    StorageMat3d *stress_tensor_3D = particles.getVariableDataByName<StorageMat3d>("StressTensor3D");
+    StorageMatd *velocity_gradient = particles.getVariableDataByName<StorageMatd>("VelocityGradient");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        vel[i] = Vecd(sin(Pi * pos[i][1] / DH), pos[i][0] * pos[i][1] / DL / DH);
+        Mat3d stress = -rho0_s * 9.8 * (DH - pos[i][1]) * Mat3d::Identity();
+        stress(0, 1) = stress(1, 0) = 100.0 * sin(Pi * pos[i][0] / DL);
+        stress_tensor_3D[i] = stress.template cast<StorageReal>();
+    }
+    auto reset_accumulators = [&]()
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            force[i] = Vecd::Zero();
+            drho_dt[i] = 0.0;
+        }
+    };
+
+    soil_advection_step_setup.exec();
+    soil_cell_linked_list.exec();
+    update_soil_inner.exec();
+    update_soil_half_inner.exec();
+    //----------------------------------------------------------------------
+    //	First half, a zero time step keeps the states unchanged.
+    //----------------------------------------------------------------------
+    reset_accumulators();
+    full_list_1st_half.exec(0.0);
+    StdVec<Vecd> reference_force(force, force + total_real_particles);
+    StdVec<Real> reference_drho_dt(drho_dt, drho_dt + total_real_particles);
+    reset_accumulators();
+    half_list_1st_half.exec(0.0);
+    EXPECT_LT(maxRelativeDifference(reference_force, force), 1.0e-6);
+    EXPECT_LT(maxRelativeDifference(reference_drho_dt, drho_dt), 1.0e-6);
+    //----------------------------------------------------------------------
+    //	Second half.
+    //----------------------------------------------------------------------
+    reset_accumulators();
+    full_list_2nd_half.exec(0.0);
+    reference_force.assign(force, force + total_real_particles);
+    StdVec<StorageMatd> reference_velocity_gradient(velocity_gradient, velocity_gradient + total_real_particles);
+    reset_accumulators();
+    half_list_2nd_half.exec(0.0);
+    EXPECT_LT(maxRelativeDifference(reference_force, force), 1.0e-6);
+    EXPECT_LT(maxRelativeDifference(reference_velocity_gradient, velocity_gradient), 1.0e-5);
+}
+//----------------------------------------------------------------------
+//	A particle is active if it is moving.
+//----------------------------------------------------------------------
+class MovingCriterion
+{
+  public:
+    explicit MovingCriterion(BaseParticles *particles)
+        : dv_vel_(particles->registerStateVariableOnly<Vecd>("Velocity")){};
+
+    class ComputingKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ComputingKernel(const ExecutionPolicy &ex_policy, MovingCriterion &encloser)
+            : vel_(encloser.dv_vel_->DelegatedDataField(ex_policy)){};
+        bool operator()(UnsignedInt index_i) { return vel_[index_i].squaredNorm() > Eps; };
+
+      protected:
+        Vecd *vel_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_vel_;
+};
+
+TEST(HalfListPlasticAcousticStep, SleepingParticlesWakeUpAsFullList)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    Real dt = 0.2 * particle_spacing / c_s;
+
+    RealBody soil_block(sph_system, makeShared<Soil>("Soil"));
+    RealBody half_list_soil_block(sph_system, makeShared<Soil>("HalfListSoil"));
+    StdVec<RealBody *> soil_blocks = {&soil_block, &half_list_soil_block};
+    for (RealBody *block : soil_blocks)
+    {
+        block->defineMaterial<PlasticContinuum>(rho0_s, c_s, Youngs_modulus, poisson, friction_angle);
+        block->generateParticles<BaseParticles, Lattice>();
+    }
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> soil_cell_linked_list(soil_block);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> half_list_soil_cell_linked_list(half_list_soil_block);
+    Relation<Inner<>> soil_inner(soil_block);
+    Relation<Inner<HalfList>> soil_half_inner(half_list_soil_block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_soil_inner(soil_inner);
+    UpdateRelation<execution::ParallelPolicy, Inner<HalfList>> update_soil_half_inner(soil_half_inner);
+    StateDynamics<execution::ParallelPolicy, fluid_dynamics::AdvectionStepSetup> soil_advection_step_setup(soil_block);
+    StateDynamics<execution::ParallelPolicy, fluid_dynamics::AdvectionStepSetup> half_list_soil_advection_step_setup(half_list_soil_block);
+    UpdateSleepingRegion<execution::ParallelPolicy, MovingCriterion> soil_sleeping_region(soil_block);
+    UpdateSleepingRegion<execution::ParallelPolicy, MovingCriterion> half_list_soil_sleeping_region(half_list_soil_block);
+    InteractionDynamicsCK<execution::ParallelPolicy, FullListStep1stHalf> full_list_1st_half(soil_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, HalfListStep1stHalf> half_list_1st_half(soil_half_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, FullListStep2ndHalf> full_list_2nd_half(soil_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, HalfListStep2ndHalf> half_list_2nd_half(soil_half_inner);
+    full_list_1st_half.skipSleepingParticles();
+    half_list_1st_half.skipSleepingParticles();
+    full_list_2nd_half.skipSleepingParticles();
+    half_list_2nd_half.skipSleepingParticles();
+    //----------------------------------------------------------------------
+    //	The left part of the blocks is moving, the rest is at rest and falls asleep.
+    //----------------------------------------------------------------------
+    size_t total_real_particles = soil_block.getBaseParticles().TotalRealParticles();
+    for (RealBody *block : soil_blocks)
+    {
+        BaseParticles &particles = block->getBaseParticles();
+        Vecd *pos = particles.ParticlePositions();
+        Vecd *vel = particles.getVariableDataByName<Vecd>("Velocity");
+        StorageMat3d *stress_tensor_3D = particles.getVariableDataByName<StorageMat3d>("StressTensor3D");
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            vel[i] = pos[i][0] < 0.3 * DL ? Vecd(0.01 * sin(Pi * pos[i][1] / DH), 0.0) : Vecd::Zero();
+            Mat3d stress = -rho0_s * 9.8 * (DH - pos[i][1]) * Mat3d::Identity();
+            stress_tensor_3D[i] = stress.template cast<StorageReal>();
+        }
+    }
+    soil_advection_step_setup.exec();
+    half_list_soil_advection_step_setup.exec();
+    soil_cell_linked_list.exec();
+    half_list_soil_cell_linked_list.exec();
+    update_soil_inner.exec();
+    update_soil_half_inner.exec();
+
+    auto run_steps = [&](size_t number_of_steps)
+    {
+        soil_sleeping_region.exec();
+        half_list_soil_sleeping_region.exec();
+        for (size_t step = 0; step != number_of_steps; ++step)
+        {
+            full_list_1st_half.exec(dt);
+            full_list_2nd_half.exec(dt);
+            half_list_1st_half.exec(dt);
+            half_list_2nd_half.exec(dt);
+        }
+    };
+    auto total_awake_particles = [&](RealBody &block)
+    {
+        return block.getBaseParticles().getSingularVariableByName<UnsignedInt>("TotalAwakeParticles")->getValue();
+    };
+
+    run_steps(10);
+    EXPECT_LT(total_awake_particles(half_list_soil_block), total_real_particles);
+    EXPECT_EQ(total_awake_particles(half_list_soil_block), total_awake_particles(soil_block));
+    //----------------------------------------------------------------------
+    //	All particles wake up, and the previously sleeping particles continue from their states.
+    //----------------------------------------------------------------------
+    for (RealBody *block : soil_blocks)
+    {
+        Vecd *vel = block->getBaseParticles().getVariableDataByName<Vecd>("Velocity");
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            vel[i] += Vecd(0.0, 0.01);
+        }
+    }
+    run_steps(10);
+    EXPECT_EQ(total_awake_particles(half_list_soil_block), total_real_particles);
+
+    BaseParticles &particles = soil_block.getBaseParticles();
+    BaseParticles &half_list_particles = half_list_soil_block.getBaseParticles();
+    auto density_change = [&](BaseParticles &body_particles)
+    {
+        Real *rho = body_particles.getVariableDataByName<Real>("Density");
+        StdVec<Real> density_change(total_real_particles);
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            density_change[i] = rho[i] - rho0_s;
+        }
+        return density_change;
+    };
+    // the return mapping amplifies the round-off differences of the pair sums over the steps,
+    // while stale accumulators of the previously sleeping particles give differences of order one
+    StdVec<Real> reference_density_change = density_change(particles);
+    Vecd *reference_vel = particles.getVariableDataByName<Vecd>("Velocity");
+    EXPECT_LT(maxRelativeDifference(reference_density_change, density_change(half_list_particles).data()), 1.0e-2);
+    EXPECT_LT(maxRelativeDifference(StdVec<Vecd>(reference_vel, reference_vel + total_real_particles),
+                                    half_list_particles.getVariableDataByName<Vecd>("Velocity")),
+              1.0e-2);
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+/**
+ * @file 	2d_batched_emitter_disposer.cpp
+ * @brief 	test that the batched emitter injection and disposer deletion
+ *          give the same particles as the particle-by-particle versions.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.02;
+Real BW = particle_spacing * 4;
+Vec2d emitter_halfsize = Vec2d(0.5 * BW, 0.5 * DH);
+Vec2d emitter_translation = emitter_halfsize;
+Vec2d disposer_halfsize = Vec2d(BW, 0.5 * DH);
+Vec2d disposer_translation = Vec2d(DL, DH) - disposer_halfsize;
+class WaterBlock : public ComplexShape
+{
+  public:
+    explicit WaterBlock(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	Shift the particles so that they cross the emitter and disposer bounds.
+//----------------------------------------------------------------------
+class ShiftParticles : public LocalDynamics
+{
+  public:
+    explicit ShiftParticles(SPHBody &sph_body)
+        : LocalDynamics(sph_body), pos_(particles_->getVariableDataByName<Vecd>("Position")){};
+    void update(size_t index_i, Real dt) { pos_[index_i][0] += 0.5 * BW; };
+
+  protected:
+    Vecd *pos_;
+};
+
+StdVec<Vecd> sortedPositions(BaseParticles &particles)
+{
+    Vecd *pos = particles.ParticlePositions();
+    StdVec<Vecd> positions(pos, pos + particles.TotalRealParticles());
+    std::sort(positions.begin(), positions.end(),
+              [](const Vecd &a, const Vecd &b)
+              { return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]); });
+    return positions;
+}
+
+TEST(BatchedEmitterDisposer, SameParticles)
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    FluidBody water_block(sph_system, makeShared<WaterBlock>("WaterBody"));
+    water_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(0.5);
+    water_block.generateParticlesWithReserve<BaseParticles, Lattice>(particle_buffer);
+    water_block.getBaseParticles().registerStateVariable<Real>("Pressure");
+
+    FluidBody batched_water_block(sph_system, makeShared<WaterBlock>("BatchedWaterBody"));
+    batched_water_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    ParticleBuffer<ReserveSizeFactor> batched_particle_buffer(0.5);
+    batched_water_block.generateParticlesWithReserve<BaseParticles, Lattice>(batched_particle_buffer);
+    batched_water_block.getBaseParticles().registerStateVariable<Real>("Pressure");
+
+    BodyAlignedBoxByParticle emitter(water_block, makeShared<AlignedBoxShape>(xAxis, Transform(emitter_translation), emitter_halfsize));
+    SimpleDynamics<fluid_dynamics::EmitterInflowInjection> emitter_injection(emitter, particle_buffer);
+    BodyAlignedBoxByCell disposer(water_block, makeShared<AlignedBoxShape>(xAxis, Transform(disposer_translation), disposer_halfsize));
+    SimpleDynamics<fluid_dynamics::DisposerOutflowDeletion> disposer_deletion(disposer);
+
+    BodyAlignedBoxByParticle batched_emitter(batched_water_block, makeShared<AlignedBoxShape>(xAxis, Transform(emitter_translation), emitter_halfsize));
+    fluid_dynamics::BatchedEmitterInflowInjection<ParallelPolicy> batched_emitter_injection(batched_emitter, batched_particle_buffer);
+    BodyAlignedBoxByCell batched_disposer(batched_water_block, makeShared<AlignedBoxShape>(xAxis, Transform(disposer_translation), disposer_halfsize));
+    fluid_dynamics::BatchedDisposerOutflowDeletion<ParallelPolicy> batched_disposer_deletion(batched_disposer);
+
+    SimpleDynamics<ShiftParticles> shift_particles(water_block);
+    SimpleDynamics<ShiftParticles> batched_shift_particles(batched_water_block);
+    sph_system.initializeSystemCellLinkedLists();
+
+    size_t initial_particles = water_block.getBaseParticles().TotalRealParticles();
+    shift_particles.exec();
+    batched_shift_particles.exec();
+    water_block.updateCellLinkedList();
+    batched_water_block.updateCellLinkedList();
+
+    BaseParticles &particles = water_block.getBaseParticles();
+    BaseParticles &batched_particles = batched_water_block.getBaseParticles();
+    emitter_injection.exec();
+    batched_emitter_injection.exec();
+    size_t injected_particles = particles.TotalRealParticles();
+    EXPECT_GT(injected_particles, initial_particles);
+    ASSERT_EQ(batched_particles.TotalRealParticles(), injected_particles);
+
+    disposer_deletion.exec();
+    batched_disposer_deletion.exec();
+    EXPECT_LT(particles.TotalRealParticles(), injected_particles);
+    ASSERT_EQ(batched_particles.TotalRealParticles(), particles.TotalRealParticles());
+
+    StdVec<Vecd> positions = sortedPositions(particles);
+    StdVec<Vecd> batched_positions = sortedPositions(batched_particles);
+    for (size_t i = 0; i != positions.size(); ++i)
+    {
+        EXPECT_LT((positions[i] - batched_positions[i]).norm(), TinyReal);
+    }
+
+    UnsignedInt *original_id = batched_particles.ParticleOriginalIds();
+    UnsignedInt *sorted_id = batched_particles.ParticleSortedIds();
+    for (size_t i = 0; i != batched_particles.TotalRealParticles(); ++i)
+    {
+        EXPECT_EQ(sorted_id[original_id[i]], i);
+    }
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+/**
+ * @file 	2d_in_situ_analysis.cpp
+ * @brief 	test the binned histogram, cumulative distribution and spatial profiles
+ *          reduced in parallel on a uniform lattice block.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+constexpr int number_of_bins = 10;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+
+TEST(InSituAnalysis, HistogramAndProfiles)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    block.generateParticles<BaseParticles, Lattice>();
+
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Real *abscissa = particles.registerStateVariable<Real>("Abscissa");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        abscissa[i] = pos[i][0];
+    }
+
+    ReduceDynamicsCK<execution::ParallelPolicy, VariableHistogramCK<number_of_bins>>
+        abscissa_histogram(block, "Abscissa", 0.0, DL);
+    ReduceDynamicsCK<execution::ParallelPolicy, VariableCumulativeDistributionCK<number_of_bins>>
+        abscissa_distribution(block, "Abscissa", 0.0, DL);
+    ReduceDynamicsCK<execution::ParallelPolicy, SpatialProfileCK<number_of_bins>>
+        volume_profile(block, 0, 0.0, DL, "VolumetricMeasure");
+    ReduceDynamicsCK<execution::ParallelPolicy, SpatialProfileCK<number_of_bins, ReduceMaxComponents>>
+        height_profile(block, 0, 0.0, DL, 1);
+    ReduceDynamicsCK<execution::SequencedPolicy, SpatialProfileCK<number_of_bins, ReduceMaxComponents>>
+        extended_height_profile(block, 0, 0.0, 2.0 * DL, 1);
+
+    BinnedData<number_of_bins> histogram = abscissa_histogram.exec();
+    BinnedData<number_of_bins> distribution = abscissa_distribution.exec();
+    BinnedData<number_of_bins> volume = volume_profile.exec();
+    BinnedData<number_of_bins> height = height_profile.exec();
+    BinnedData<number_of_bins> extended_height = extended_height_profile.exec();
+
+    EXPECT_NEAR(histogram.sum(), Real(total_real_particles), Eps);
+    Real column_volume = DL * DH / Real(number_of_bins);
+    for (int k = 0; k != number_of_bins; ++k)
+    {
+        EXPECT_NEAR(histogram[k], Real(total_real_particles) / Real(number_of_bins), Eps);
+        EXPECT_NEAR(distribution[k], Real(k + 1) / Real(number_of_bins), 1.0e-6);
+        EXPECT_NEAR(volume[k], column_volume, 1.0e-6);
+        EXPECT_NEAR(height[k], DH - 0.5 * particle_spacing, 1.0e-6);
+    }
+    for (int k = 0; k != number_of_bins / 2; ++k)
+    {
+        EXPECT_NEAR(extended_height[k], DH - 0.5 * particle_spacing, 1.0e-6);
+        EXPECT_EQ(extended_height[k + number_of_bins / 2], -MaxReal);
+    }
+    EXPECT_NEAR(abscissa_distribution.getPercentile(distribution, 0.5), 0.5 * DL, DL / Real(number_of_bins));
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,162 @@
+/**
+ * @file 	2d_static_inner_configuration.cpp
+ * @brief 	test that the solid dynamics using the pre-computed static inner configuration
+ *          give the same result as using the generic inner configuration.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 0.4;
+Real DH = 0.2;
+Real particle_spacing = 0.01;
+Real rho0_s = 1.0e3;
+Real Youngs_modulus = 2.0e6;
+Real poisson = 0.3975;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	A smooth deformation and velocity field.
+//----------------------------------------------------------------------
+class DeformedState : public LocalDynamics
+{
+  public:
+    explicit DeformedState(SPHBody &sph_body)
+        : LocalDynamics(sph_body),
+          pos_(particles_->getVariableDataByName<Vecd>("Position")),
+          vel_(particles_->registerStateVariable<Vecd>("Velocity")){};
+
+    void update(size_t index_i, Real dt = 0.0)
+    {
+        Vecd pos0 = pos_[index_i];
+        pos_[index_i] += 0.05 * Vecd(sin(pos0[1] / DH), pos0[0] * pos0[1] / DL / DH);
+        vel_[index_i] = Vecd(pos0[1] * pos0[1], -sin(pos0[0] / DL));
+    };
+
+  protected:
+    Vecd *pos_, *vel_;
+};
+
+//----------------------------------------------------------------------
+//	Largest difference of the forces of a first half of the stress relaxation
+//	with the static and the generic configuration, relative to the largest force.
+//	A zero time step keeps the state unchanged.
+//----------------------------------------------------------------------
+template <class FirstHalfType>
+Real relativeForceDifference(BaseInnerRelation &inner_relation,
+                             solid_dynamics::StaticInnerConfiguration &static_configuration)
+{
+    Dynamics1Level<FirstHalfType> generic_first_half(inner_relation);
+    Dynamics1Level<FirstHalfType> static_first_half(inner_relation);
+    static_first_half.useStaticConfiguration(static_configuration);
+
+    BaseParticles &particles = inner_relation.getSPHBody().getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *force = particles.getVariableDataByName<Vecd>("Force");
+    generic_first_half.exec(0.0);
+    StdVec<Vecd> generic_force(force, force + total_real_particles);
+    Real max_force = 0.0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        max_force = SMAX(max_force, generic_force[i].norm());
+        force[i] = Vecd::Zero();
+    }
+    static_first_half.exec(0.0);
+    Real max_force_difference = 0.0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        max_force_difference = SMAX(max_force_difference, (force[i] - generic_force[i]).norm());
+    }
+    EXPECT_GT(max_force, 0.0);
+    return max_force_difference / max_force;
+}
+
+TEST(StaticInnerConfiguration, SameResultAsGenericConfiguration)
+{
+    BoundingBox system_domain_bounds(Vec2d(-DL, -DH), Vec2d(2.0 * DL, 2.0 * DH));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+
+    SolidBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<SaintVenantKirchhoffSolid>(rho0_s, Youngs_modulus, poisson);
+    block.generateParticles<BaseParticles, Lattice>();
+    InnerRelation block_inner(block);
+
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> block_corrected_configuration(block_inner);
+    solid_dynamics::StaticInnerConfiguration block_static_configuration(block_inner);
+    SimpleDynamics<DeformedState> block_deformed_state(block);
+    InteractionDynamics<solid_dynamics::DeformationGradientBySummation> generic_deformation_gradient(block_inner);
+    InteractionDynamics<solid_dynamics::DeformationGradientBySummation> static_deformation_gradient(block_inner);
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> static_first_half(block_inner);
+
+    SolidBody plastic_block(sph_system, makeShared<Block>("PlasticBlock"));
+    plastic_block.defineMaterial<HardeningPlasticSolid>(rho0_s, Youngs_modulus, poisson, 1.0e4, 1.0e5);
+    plastic_block.generateParticles<BaseParticles, Lattice>();
+    InnerRelation plastic_block_inner(plastic_block);
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> plastic_block_corrected_configuration(plastic_block_inner);
+    solid_dynamics::StaticInnerConfiguration plastic_block_static_configuration(plastic_block_inner);
+    SimpleDynamics<DeformedState> plastic_block_deformed_state(plastic_block);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    block_corrected_configuration.exec();
+    block_static_configuration.exec();
+    static_deformation_gradient.useStaticConfiguration(block_static_configuration);
+    static_first_half.useStaticConfiguration(block_static_configuration);
+    block_deformed_state.exec();
+    plastic_block_corrected_configuration.exec();
+    plastic_block_static_configuration.exec();
+    plastic_block_deformed_state.exec();
+
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Matd *F = particles.getVariableDataByName<Matd>("DeformationGradient");
+    //----------------------------------------------------------------------
+    //	Deformation gradient by summation.
+    //----------------------------------------------------------------------
+    generic_deformation_gradient.exec();
+    StdVec<Matd> generic_F(F, F + total_real_particles);
+    static_deformation_gradient.exec();
+    Real max_F_difference = 0.0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        max_F_difference = SMAX(max_F_difference, (F[i] - generic_F[i]).norm());
+    }
+    EXPECT_LT(max_F_difference, 1.0e-8);
+    //----------------------------------------------------------------------
+    //	First half of the stress relaxation.
+    //----------------------------------------------------------------------
+    EXPECT_LT(relativeForceDifference<solid_dynamics::Integration1stHalfPK2>(
+                  block_inner, block_static_configuration),
+              1.0e-8);
+    EXPECT_LT(relativeForceDifference<solid_dynamics::DecomposedIntegration1stHalf>(
+                  block_inner, block_static_configuration),
+              1.0e-8);
+    EXPECT_LT(relativeForceDifference<solid_dynamics::DecomposedPlasticIntegration1stHalf>(
+                  plastic_block_inner, plastic_block_static_configuration),
+              1.0e-8);
+    //----------------------------------------------------------------------
+    //	Using the static configuration after the correction matrix is changed is an error.
+    //----------------------------------------------------------------------
+    Matd *B = particles.getVariableDataByName<Matd>("LinearGradientCorrectionMatrix");
+    B[0] *= 2.0;
+    EXPECT_EXIT(static_first_half.useStaticConfiguration(block_static_configuration),
+                testing::ExitedWithCode(1), "");
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+/**
+ * @file 	2d_checkpoint_restart.cpp
+ * @brief 	test that a body generated from a checkpoint recovers the particle bounds,
+ *          the sorted order and the particle states of the checkpointed body.
+ * @author 	Xiangyu Hu
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 1.0;
+Real DH = 0.6;
+Real particle_spacing = 0.02;
+size_t checkpoint_step = 100;
+class Block : public ComplexShape
+{
+  public:
+    explicit Block(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd halfsize(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(halfsize), halfsize);
+    }
+};
+
+TEST(CheckpointIO, GenerateParticlesFromCheckpoint)
+{
+    BoundingBox system_domain_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+    //----------------------------------------------------------------------
+    //	Write the checkpoint after some particles are switched to buffer.
+    //----------------------------------------------------------------------
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    RealBody block(sph_system, makeShared<Block>("Block"));
+    block.defineMaterial<Solid>();
+    ParticleBuffer<ReserveSizeFactor> block_buffer(0.5);
+    block.generateParticlesWithReserve<BaseParticles, Lattice>(block_buffer);
+    BaseParticles &particles = block.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Vecd *vel = particles.registerStateVariable<Vecd>(
+        "Velocity", [&](size_t i) -> Vecd { return pos[i] - Vecd(0.5 * DL, 0.5 * DH); });
+    particles.switchToBufferParticle(0);
+    particles.switchToBufferParticle(10);
+    *sph_system.getSystemVariableDataByName<Real>("PhysicalTime") = 1.5;
+    CheckpointIO checkpoint_io(sph_system);
+    checkpoint_io.writeToFile(checkpoint_step);
+    //----------------------------------------------------------------------
+    //	Generate a new body directly from the checkpoint.
+    //----------------------------------------------------------------------
+    SPHSystem restart_system(system_domain_bounds, particle_spacing);
+    restart_system.setRestartStep(checkpoint_step);
+    restart_system.setIOEnvironment();
+    RealBody restart_block(restart_system, makeShared<Block>("Block"));
+    restart_block.defineMaterial<Solid>();
+    ParticleBuffer<ReserveSizeFromCheckpoint> restart_block_buffer;
+    restart_block.generateParticlesWithReserve<BaseParticles, Checkpoint>(restart_block_buffer, checkpoint_step);
+    BaseParticles &restart_particles = restart_block.getBaseParticles();
+    Vecd *restart_vel = restart_particles.registerStateVariable<Vecd>("Velocity");
+    CheckpointIO restart_checkpoint_io(restart_system);
+    Real restart_time = restart_checkpoint_io.readRestartFiles(execution::par, checkpoint_step);
+
+    EXPECT_NEAR(restart_time, 1.5, 1.0e-9);
+    EXPECT_EQ(restart_particles.TotalRealParticles(), particles.TotalRealParticles());
+    EXPECT_EQ(restart_particles.RealParticlesBound(), particles.RealParticlesBound());
+    Vecd *restart_pos = restart_particles.ParticlePositions();
+    UnsignedInt *original_id = particles.ParticleOriginalIds();
+    UnsignedInt *restart_original_id = restart_particles.ParticleOriginalIds();
+    UnsignedInt *restart_sorted_id = restart_particles.ParticleSortedIds();
+    for (size_t i = 0; i != restart_particles.TotalRealParticles(); ++i)
+    {
+        EXPECT_EQ(restart_original_id[i], original_id[i]);
+        EXPECT_EQ(restart_sorted_id[restart_original_id[i]], i);
+        EXPECT_LT((restart_pos[i] - pos[i]).norm(), 1.0e-5);
+        EXPECT_LT((restart_vel[i] - vel[i]).norm(), 1.0e-5);
+    }
+}
+//----------------------------------------------------------------------
+//	The main program.
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}